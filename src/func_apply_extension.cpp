@@ -9,11 +9,34 @@
 // SCALAR FUNCTIONS:
 //   - apply(func, ...args) - Call a scalar function or macro by name
 //   - apply_with(func, args := [...], kwargs := {...}) - Structured call
+//   - partial(func, fixed_args, fixed_kwargs) - Function descriptor for apply_with
+//   - apply_chain([func, ...], ...args) - Call each function on the previous result
+//   - apply_expr(expr, ...args) - Evaluate an expression given as text, with $n placeholders
+//   - apply_map(func, list) / apply_filter(pred, list) - A function over list elements
+//   - apply_reduce(func, list [, init]) - Left fold of a list with a binary function
+//   - apply_each(func, ...cols) / apply_many(funcs, ...args) - Fan-out calls returning a STRUCT
+//   - apply_fields(func, struct_or_map) - A function over the fields of a STRUCT or MAP
 //   - function_exists(func) - Check if a function exists
 //
+// AGGREGATE FUNCTIONS:
+//   - apply_agg(func, ...args) - Call an aggregate function by name (constant or per group)
+//   - apply_window(func, ...args) OVER (...) - Call a window or aggregate function by name
+//
 // TABLE FUNCTIONS:
 //   - apply_table(func, ...args) - Call a table function by name
 //   - apply_table_with(func, args := [...], kwargs := {...}) - Structured call
+//   - apply_table_many(func, arg_sets) - One call per argument set, unioned
+//   - apply_table_each(func, ...args, columns := ...) - Per-row call (lateral)
+//   - cache := true on apply_table/apply_table_with - Cached results, see
+//     func_apply_set_cache_limit() and func_apply_clear_cache()
+//
+// SETTINGS:
+//   - func_apply_set_memoize(enabled [, capacity]) - Remember results of dynamic calls,
+//     see func_apply_memo_stats()
+//   - func_apply_stats() / func_apply_reset_stats() - Call statistics per target function
+//   - func_apply_explain(query) - Dispatch strategy of each apply expression of a query
+//   - func_apply_create_dispatcher(name, candidates) / func_apply_drop_dispatcher(name) -
+//     Named functions that dispatch over a fixed set
 //
 //===--------------------------------------------------------------------===//
 // IMPORTANT IMPLEMENTATION NOTES FOR FUTURE DEVELOPERS
@@ -45,9 +68,13 @@
 //    GetCallableFunctionType() checks SCALAR first, then MACRO.
 //
 // 4. BIND vs EXECUTE PATHS:
-//    - Scalar functions: Use FunctionBinder directly (fast, avoids deadlock)
-//    - Macros: Must use full expression binding via ConstantBinder
-//    - Table functions: Use bind_replace to generate SQL dynamically
+//    - Scalar functions and macros (apply, apply_with): The call is bound once per
+//      name and argument types with an ExpressionBinder and executed vectorized over
+//      each group of rows (see "Vectorized target execution")
+//    - Validators: FunctionBinder for scalar functions, ConstantBinder for macros
+//    - Aggregates: The bind callback replaces apply_agg with the target aggregate
+//    - Window functions: A placeholder aggregate rewritten by an optimizer extension
+//    - Table functions: Use bind_replace to substitute a call to the target
 //
 //===--------------------------------------------------------------------===//
 
@@ -58,30 +85,61 @@
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/catalog/catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/scalar_function_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
 #include "duckdb/common/enums/catalog_type.hpp"
+#include "duckdb/common/map.hpp"
 #include "duckdb/common/types/value.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/function/function_binder.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/materialized_query_result.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression_binder.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/parser/expression/columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_window_expression.hpp"
+#include "duckdb/planner/operator/logical_window.hpp"
+#include "duckdb/optimizer/optimizer_extension.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
 #include <duckdb/parser/parsed_data/create_scalar_function_info.hpp>
+#include "duckdb/parser/parsed_data/drop_info.hpp"
 #include "duckdb/parser/expression/function_expression.hpp"
 #include "duckdb/parser/expression/constant_expression.hpp"
+#include "duckdb/parser/expression/parameter_expression.hpp"
+#include "duckdb/parser/parsed_expression_iterator.hpp"
+#include "duckdb/parser/parser.hpp"
 #include "duckdb/planner/binder.hpp"
 #include "duckdb/planner/expression_binder/constant_binder.hpp"
 #include "duckdb/catalog/entry_lookup_info.hpp"
 #include "duckdb/function/table_function.hpp"
-#include "duckdb/parser/parser.hpp"
 #include "duckdb/parser/tableref/subqueryref.hpp"
+#include "duckdb/parser/tableref/table_function_ref.hpp"
 #include "duckdb/parser/statement/select_statement.hpp"
+#include "duckdb/parser/statement/logical_plan_statement.hpp"
+#include "duckdb/planner/planner.hpp"
+#include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
+#include "duckdb/main/client_context_state.hpp"
+#include "duckdb/parser/query_node/select_node.hpp"
+#include "duckdb/parser/query_node/set_operation_node.hpp"
+#include "duckdb/parser/expression/star_expression.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+#include "duckdb/storage/object_cache.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <unordered_set>
 #include <mutex>
+#include <list>
 
 namespace duckdb {
 
@@ -298,9 +356,10 @@ static bool ValidateFunctionCall(ClientContext &context, const string &func_name
 	}
 
 	if (!allowed) {
+		// A PermissionException, so that error-tolerant calls do not turn a block into a NULL
 		if (config.on_block == "error") {
-			throw InvalidInputException("Function '%s' is blocked by func_apply security policy (mode: %s)", func_name,
-			                            config.mode);
+			throw PermissionException("Function '%s' is blocked by func_apply security policy (mode: %s)", func_name,
+			                          config.mode);
 		}
 		return false;
 	}
@@ -399,87 +458,6 @@ static bool IsValidIdentifier(const string &name) {
 	return true;
 }
 
-// Convert a DuckDB Value to a SQL literal string with proper escaping
-static string ValueToSQL(const Value &val) {
-	if (val.IsNull()) {
-		return "NULL";
-	}
-
-	switch (val.type().id()) {
-	case LogicalTypeId::VARCHAR: {
-		// Escape single quotes by doubling them
-		string str = val.ToString();
-		string escaped;
-		escaped.reserve(str.size() + 2);
-		escaped += '\'';
-		for (char c : str) {
-			if (c == '\'') {
-				escaped += "''";
-			} else {
-				escaped += c;
-			}
-		}
-		escaped += '\'';
-		return escaped;
-	}
-	case LogicalTypeId::BLOB: {
-		return "'" + val.ToString() + "'::BLOB";
-	}
-	case LogicalTypeId::LIST: {
-		string result = "[";
-		auto &children = ListValue::GetChildren(val);
-		for (size_t i = 0; i < children.size(); i++) {
-			if (i > 0) {
-				result += ", ";
-			}
-			result += ValueToSQL(children[i]);
-		}
-		result += "]";
-		return result;
-	}
-	case LogicalTypeId::STRUCT: {
-		string result = "{";
-		auto &children = StructValue::GetChildren(val);
-		auto &type = val.type();
-		for (size_t i = 0; i < children.size(); i++) {
-			if (i > 0) {
-				result += ", ";
-			}
-			result += "'" + StructType::GetChildName(type, i) + "': ";
-			result += ValueToSQL(children[i]);
-		}
-		result += "}";
-		return result;
-	}
-	case LogicalTypeId::BOOLEAN:
-	case LogicalTypeId::TINYINT:
-	case LogicalTypeId::SMALLINT:
-	case LogicalTypeId::INTEGER:
-	case LogicalTypeId::BIGINT:
-	case LogicalTypeId::UTINYINT:
-	case LogicalTypeId::USMALLINT:
-	case LogicalTypeId::UINTEGER:
-	case LogicalTypeId::UBIGINT:
-	case LogicalTypeId::FLOAT:
-	case LogicalTypeId::DOUBLE:
-	case LogicalTypeId::HUGEINT:
-	case LogicalTypeId::UHUGEINT:
-		// Numeric types can be used directly
-		return val.ToString();
-	case LogicalTypeId::DATE:
-		return "'" + val.ToString() + "'::DATE";
-	case LogicalTypeId::TIME:
-		return "'" + val.ToString() + "'::TIME";
-	case LogicalTypeId::TIMESTAMP:
-		return "'" + val.ToString() + "'::TIMESTAMP";
-	case LogicalTypeId::INTERVAL:
-		return "'" + val.ToString() + "'::INTERVAL";
-	default:
-		// For other types, try to use as string literal with cast
-		return "'" + StringUtil::Replace(val.ToString(), "'", "''") + "'::" + val.type().ToString();
-	}
-}
-
 // Helper to check if a function of a specific type exists
 //
 // IMPORTANT DISCOVERY: DuckDB's catalog.GetEntry(context, type, schema, name, ...)
@@ -491,13 +469,14 @@ static string ValueToSQL(const Value &val) {
 //
 // Neither API does what we want (return null on type mismatch), so we use the
 // non-throwing version and add our own type check.
-static bool FunctionExistsOfType(ClientContext &context, const string &func_name, CatalogType type) {
+static optional_ptr<CatalogEntry> GetFunctionEntryOfType(ClientContext &context, const string &func_name,
+                                                         CatalogType type) {
 	// First check system catalog (built-in functions)
 	auto &system_catalog = Catalog::GetSystemCatalog(context);
 	auto entry = system_catalog.GetEntry(context, type, DEFAULT_SCHEMA, func_name, OnEntryNotFound::RETURN_NULL);
 
 	if (entry && entry->type == type) {
-		return true;
+		return entry;
 	}
 
 	// Also check the default database catalog (user-defined functions/macros)
@@ -509,12 +488,16 @@ static bool FunctionExistsOfType(ClientContext &context, const string &func_name
 			auto user_entry =
 			    catalog_entry->GetEntry(context, type, DEFAULT_SCHEMA, func_name, OnEntryNotFound::RETURN_NULL);
 			if (user_entry && user_entry->type == type) {
-				return true;
+				return user_entry;
 			}
 		}
 	}
 
-	return false;
+	return nullptr;
+}
+
+static bool FunctionExistsOfType(ClientContext &context, const string &func_name, CatalogType type) {
+	return GetFunctionEntryOfType(context, func_name, type) != nullptr;
 }
 
 // Helper to find what type of callable function exists (for apply/apply_with)
@@ -618,308 +601,4467 @@ static Value ExecuteFunctionInternal(ClientContext &context, const string &func_
 	throw InvalidInputException("Function '%s' is not a scalar function or macro", func_name);
 }
 
-// Public version that always performs security check
-static Value ExecuteFunction(ClientContext &context, const string &func_name, const vector<Value> &args) {
-	return ExecuteFunctionInternal(context, func_name, args, false);
-}
-
 //===--------------------------------------------------------------------===//
-// apply(func VARCHAR, ...args ANY) -> ANY
+// Vectorized target execution
 //===--------------------------------------------------------------------===//
+//
+// Instead of evaluating the target once per row from Values, rows of a chunk are grouped
+// by function name and argument layout. For each group the target call is bound once per
+// thread against the argument types (inputs become BoundReferenceExpressions) and run
+// through an ExpressionExecutor over the group's slice of the input, so a chunk costs one
+// vectorized call per distinct name.
+//
+// Scalar functions and macros share this path: the call is parsed as a FunctionExpression
+// over column references to a generic binding that stands in for the input columns, and
+// bound with a regular ExpressionBinder. Overload resolution, implicit casts and macro
+// expansion are therefore exactly those of a direct call.
+
+static constexpr const char *APPLY_ARGS_BINDING = "__func_apply_args";
+
+// One argument of a target call, in call order
+struct ApplyArgument {
+	// Input column that feeds this argument
+	idx_t input_index;
+	// Parameter name for named macro parameters, empty for positional arguments
+	string name;
+	// Fixed by a constant partial() descriptor: bound as fixed_value instead of an input column
+	bool fixed;
+	Value fixed_value;
+};
 
-static unique_ptr<FunctionData> BindApply(ClientContext &context, ScalarFunction &bound_function,
-                                          vector<unique_ptr<Expression>> &arguments) {
-	// Default return type
-	bound_function.return_type = LogicalType::VARCHAR;
-
-	// If no arguments beyond function name, nothing to infer
-	if (arguments.empty()) {
-		return nullptr;
+// A constant partial() descriptor, unpacked at bind time. Its fixed arguments are bound into
+// the target as constants, so each call only feeds the remaining arguments.
+struct ApplyPartial {
+	string func_name;
+	vector<Value> positional;
+	// fixed_kwargs that the call's own kwargs do not override
+	vector<string> names;
+	vector<Value> named;
+
+	bool operator==(const ApplyPartial &other) const {
+		return func_name == other.func_name && SameValues(positional, other.positional) && names == other.names &&
+		       SameValues(named, other.named);
 	}
 
-	// Check if function name is a compile-time constant
-	if (!arguments[0]->IsFoldable()) {
-		return nullptr;
+private:
+	// Values are compared by type first, so that comparing never casts
+	static bool SameValues(const vector<Value> &left, const vector<Value> &right) {
+		if (left.size() != right.size()) {
+			return false;
+		}
+		for (idx_t i = 0; i < left.size(); i++) {
+			if (left[i].type() != right[i].type() || !Value::NotDistinctFrom(left[i], right[i])) {
+				return false;
+			}
+		}
+		return true;
 	}
+};
 
-	// Evaluate to get function name
-	Value func_name_val = ExpressionExecutor::EvaluateScalar(context, *arguments[0]);
-	if (func_name_val.IsNull()) {
-		return nullptr;
+class ApplyArgumentBinder : public ExpressionBinder {
+public:
+	ApplyArgumentBinder(Binder &binder, ClientContext &context) : ExpressionBinder(binder, context) {
 	}
-	string func_name = StringValue::Get(func_name_val);
 
-	// Validate function name
-	if (!IsValidIdentifier(func_name)) {
-		return nullptr;
+protected:
+	// Arguments are bound against a chunk of input rows, so like constant expressions they
+	// cannot contain subqueries (a macro body may) or window functions
+	BindResult BindExpression(unique_ptr<ParsedExpression> &expr_ptr, idx_t depth, bool root_expression) override {
+		switch (expr_ptr->GetExpressionClass()) {
+		case ExpressionClass::SUBQUERY:
+			throw BinderException("subqueries cannot be called through apply");
+		case ExpressionClass::WINDOW:
+			return BindResult("window functions cannot be called through apply, use apply_window() instead");
+		default:
+			return ExpressionBinder::BindExpression(expr_ptr, depth, root_expression);
+		}
 	}
 
-	// Check the function type (only scalar functions and macros are callable via apply)
-	auto func_type = GetCallableFunctionType(context, func_name);
+	string UnsupportedAggregateMessage() override {
+		return "aggregate functions cannot be called through apply, use apply_agg() instead";
+	}
+};
 
-	if (func_type == CatalogType::SCALAR_FUNCTION_ENTRY) {
-		// For scalar functions, use FunctionBinder directly
-		// FunctionBinder handles overload resolution and type coercion automatically
-		vector<unique_ptr<Expression>> target_args;
-		for (idx_t i = 1; i < arguments.size(); i++) {
-			target_args.push_back(arguments[i]->Copy());
+// Replace column references to the generic argument binding by references into the input chunk
+static void ReplaceArgumentReferences(unique_ptr<Expression> &expr, idx_t table_index) {
+	if (expr->GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF) {
+		auto &colref = expr->Cast<BoundColumnRefExpression>();
+		if (colref.binding.table_index == table_index) {
+			expr = make_uniq<BoundReferenceExpression>(colref.return_type, colref.binding.column_index);
+			return;
 		}
+	}
+	ExpressionIterator::EnumerateChildren(
+	    *expr, [&](unique_ptr<Expression> &child) { ReplaceArgumentReferences(child, table_index); });
+}
 
-		ErrorData error;
-		FunctionBinder binder(context);
-		auto bound_expr = binder.BindScalarFunction(DEFAULT_SCHEMA, func_name, std::move(target_args), error);
-
-		if (error.HasError() || !bound_expr) {
-			return nullptr;
-		}
+// Reference to input column i through the generic argument binding
+static unique_ptr<ParsedExpression> MakeArgumentReference(idx_t i) {
+	return make_uniq<ColumnRefExpression>("a" + to_string(i), APPLY_ARGS_BINDING);
+}
 
-		bound_function.return_type = bound_expr->return_type;
-		return nullptr;
+// Bind an expression over argument references for input columns of the given types
+static unique_ptr<Expression> BindApplyExpression(ClientContext &context, const vector<LogicalType> &input_types,
+                                                  unique_ptr<ParsedExpression> expr) {
+	auto binder = Binder::CreateBinder(context);
+	auto table_index = binder->GenerateTableIndex();
+	vector<string> column_names;
+	for (idx_t i = 0; i < input_types.size(); i++) {
+		column_names.push_back("a" + to_string(i));
 	}
+	binder->bind_context.AddGenericBinding(table_index, APPLY_ARGS_BINDING, column_names, input_types);
 
-	if (func_type == CatalogType::MACRO_ENTRY) {
-		// For macros, use the full expression binding path
-		vector<unique_ptr<ParsedExpression>> parsed_args;
-		for (idx_t i = 1; i < arguments.size(); i++) {
-			// Try to evaluate constant expressions, otherwise create a placeholder
-			if (arguments[i]->IsFoldable()) {
-				auto val = ExpressionExecutor::EvaluateScalar(context, *arguments[i]);
-				parsed_args.push_back(make_uniq<ConstantExpression>(val));
-			} else {
-				// For non-constant expressions, we need to use the expression's type
-				// Create a constant with a dummy value of the right type
-				parsed_args.push_back(make_uniq<ConstantExpression>(Value(arguments[i]->return_type)));
-			}
-		}
-
-		unique_ptr<ParsedExpression> func_expr = make_uniq<FunctionExpression>(func_name, std::move(parsed_args));
+	ApplyArgumentBinder expression_binder(*binder, context);
+	auto bound = expression_binder.Bind(expr);
+	ReplaceArgumentReferences(bound, table_index);
+	return bound;
+}
 
-		try {
-			auto binder = Binder::CreateBinder(context);
-			ConstantBinder constant_binder(*binder, context, "apply");
-			auto bound_expr = constant_binder.Bind(func_expr);
-			bound_function.return_type = bound_expr->return_type;
-		} catch (...) {
-			// If binding fails, fall back to VARCHAR
-			return nullptr;
+// Throw if func_name is not a scalar function or macro
+static void CheckApplyTargetName(ClientContext &context, const string &func_name) {
+	auto func_type = GetCallableFunctionType(context, func_name);
+	if (func_type == CatalogType::INVALID) {
+		if (TableFunctionExists(context, func_name)) {
+			throw InvalidInputException("Function '%s' is a table function. Use apply_table() instead.", func_name);
 		}
+		if (FunctionExistsOfType(context, func_name, CatalogType::AGGREGATE_FUNCTION_ENTRY)) {
+			throw InvalidInputException("Function '%s' is an aggregate function. Use apply_agg() instead.",
+			                            func_name);
+		}
+		throw InvalidInputException("Function '%s' does not exist", func_name);
+	}
+}
 
-		return nullptr;
+// Bind func_name(arguments...) for input columns of the given types. Each function in `then`
+// is called in turn on the result of the previous call, all in one expression.
+static unique_ptr<Expression> BindApplyTarget(ClientContext &context, const string &func_name,
+                                              const vector<LogicalType> &input_types,
+                                              const vector<ApplyArgument> &arguments,
+                                              const vector<string> &then = {}) {
+	CheckApplyTargetName(context, func_name);
+	for (auto &next_name : then) {
+		CheckApplyTargetName(context, next_name);
 	}
 
-	// For other types, keep default VARCHAR
-	return nullptr;
+	vector<unique_ptr<ParsedExpression>> children;
+	for (auto &argument : arguments) {
+		unique_ptr<ParsedExpression> child;
+		if (argument.fixed) {
+			child = make_uniq<ConstantExpression>(argument.fixed_value);
+		} else {
+			child = MakeArgumentReference(argument.input_index);
+		}
+		child->alias = argument.name;
+		children.push_back(std::move(child));
+	}
+	unique_ptr<ParsedExpression> call = make_uniq<FunctionExpression>(func_name, std::move(children));
+	for (auto &next_name : then) {
+		vector<unique_ptr<ParsedExpression>> next_children;
+		next_children.push_back(std::move(call));
+		call = make_uniq<FunctionExpression>(next_name, std::move(next_children));
+	}
+	return BindApplyExpression(context, input_types, std::move(call));
 }
 
-static void ApplyScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
-	auto &context = state.GetContext();
-	idx_t count = args.size();
+// Arrange positional inputs [0, n) and named inputs [n, n + k) in call order. Macros take
+// named parameters directly. Scalar functions do not, so each name is mapped to a position
+// using the parameter names documented for one of the function's overloads.
+static vector<ApplyArgument> ResolveApplyArguments(ClientContext &context, const string &func_name,
+                                                   idx_t positional_count, const vector<string> &named) {
+	vector<ApplyArgument> arguments;
+	for (idx_t i = 0; i < positional_count; i++) {
+		arguments.push_back({i, string()});
+	}
+	if (named.empty()) {
+		return arguments;
+	}
+	if (GetCallableFunctionType(context, func_name) != CatalogType::SCALAR_FUNCTION_ENTRY) {
+		for (idx_t k = 0; k < named.size(); k++) {
+			arguments.push_back({positional_count + k, named[k]});
+		}
+		return arguments;
+	}
 
-	for (idx_t i = 0; i < count; i++) {
-		// Get function name
-		auto func_name_val = args.data[0].GetValue(i);
-		if (func_name_val.IsNull()) {
-			result.SetValue(i, Value());
+	auto &entry = GetFunctionEntryOfType(context, func_name, CatalogType::SCALAR_FUNCTION_ENTRY)
+	                  ->Cast<ScalarFunctionCatalogEntry>();
+	auto total = positional_count + named.size();
+	for (auto &description : entry.descriptions) {
+		auto &parameter_names = description.parameter_names;
+		if (parameter_names.size() < total) {
 			continue;
 		}
-
-		string func_name = StringValue::Get(func_name_val);
-
-		// Validate function name
-		if (!IsValidIdentifier(func_name)) {
-			throw InvalidInputException("apply: invalid function name '%s'", func_name);
+		// slots[p] is the input column passed as parameter p
+		vector<optional_idx> slots(total);
+		for (idx_t i = 0; i < positional_count; i++) {
+			slots[i] = i;
 		}
-
-		// Collect arguments
-		vector<Value> func_args;
-		for (idx_t j = 1; j < args.ColumnCount(); j++) {
-			func_args.push_back(args.data[j].GetValue(i));
+		bool matched = true;
+		for (idx_t k = 0; k < named.size() && matched; k++) {
+			matched = false;
+			for (idx_t p = positional_count; p < total; p++) {
+				if (!slots[p].IsValid() && StringUtil::CIEquals(parameter_names[p], named[k])) {
+					slots[p] = positional_count + k;
+					matched = true;
+					break;
+				}
+			}
+		}
+		if (!matched) {
+			continue;
+		}
+		arguments.clear();
+		for (auto &slot : slots) {
+			arguments.push_back({slot.GetIndex(), string()});
 		}
+		return arguments;
+	}
+	throw InvalidInputException("Function '%s' has no parameters named '%s' after %d positional arguments", func_name,
+	                            StringUtil::Join(named, "', '"), positional_count);
+}
 
-		// Execute the function
-		try {
-			auto val = ExecuteFunction(context, func_name, func_args);
-			result.SetValue(i, val);
-		} catch (const Exception &e) {
-			throw InvalidInputException("apply('%s'): %s", func_name, e.what());
+// Arrange the inputs of a partial() call: the descriptor's fixed positional arguments come
+// before the inputs' and its fixed named arguments join theirs, then every fixed argument is
+// swapped for its constant value
+static vector<ApplyArgument> ResolvePartialArguments(ClientContext &context, const ApplyPartial &partial,
+                                                     idx_t positional_count, const vector<string> &named) {
+	auto fixed_count = partial.positional.size();
+	auto all_named = partial.names;
+	all_named.insert(all_named.end(), named.begin(), named.end());
+	auto arguments = ResolveApplyArguments(context, partial.func_name, fixed_count + positional_count, all_named);
+	// Resolved indexes are into [fixed positional, positional, fixed named, named]
+	auto named_start = fixed_count + positional_count;
+	for (auto &argument : arguments) {
+		auto idx = argument.input_index;
+		if (idx < fixed_count) {
+			argument.fixed = true;
+			argument.fixed_value = partial.positional[idx];
+		} else if (idx < named_start) {
+			argument.input_index = idx - fixed_count;
+		} else if (idx < named_start + partial.names.size()) {
+			argument.fixed = true;
+			argument.fixed_value = partial.named[idx - named_start];
+		} else {
+			argument.input_index = idx - fixed_count - partial.names.size();
 		}
 	}
+	return arguments;
 }
 
 //===--------------------------------------------------------------------===//
-// apply_with(func VARCHAR, args LIST, kwargs STRUCT) -> ANY
+// Memoization
 //===--------------------------------------------------------------------===//
+//
+// With func_apply_set_memoize(true), dynamic calls remember the results of recent argument
+// tuples, per thread and per bound target (so per function and argument types):
+//
+//   SELECT func_apply_set_memoize(true);
+//   SELECT apply('geocode', address) FROM clicks;   -- each distinct address computed once
+//
+// Only targets whose whole expression is CONSISTENT are memoized. A table holds up to
+// `capacity` entries (default 4096) and is emptied when full. Repeats within a chunk are
+// computed once too. Hits and misses are counted per session, see func_apply_memo_stats().
 
-// Bind data for apply_with - stores which columns are args vs kwargs
-struct ApplyWithBindData : public FunctionData {
-	idx_t args_idx = 1;      // Column index for args (default: second arg)
-	idx_t kwargs_idx = 2;    // Column index for kwargs (default: third arg)
-	bool has_kwargs = false; // Whether kwargs was provided
+struct ApplyMemoCounters {
+	std::atomic<idx_t> hits {0};
+	std::atomic<idx_t> misses {0};
+};
 
-	unique_ptr<FunctionData> Copy() const override {
-		auto result = make_uniq<ApplyWithBindData>();
-		result->args_idx = args_idx;
-		result->kwargs_idx = kwargs_idx;
-		result->has_kwargs = has_kwargs;
-		return std::move(result);
-	}
-	bool Equals(const FunctionData &other) const override {
-		auto &o = other.Cast<ApplyWithBindData>();
-		return args_idx == o.args_idx && kwargs_idx == o.kwargs_idx && has_kwargs == o.has_kwargs;
-	}
+// Memoization settings per session, registered on the connection so they go away with it
+struct FuncApplyMemoConfig : public ClientContextState {
+	bool enabled = false;
+	idx_t capacity = 4096;
+	shared_ptr<ApplyMemoCounters> counters = make_shared_ptr<ApplyMemoCounters>();
 };
 
-static unique_ptr<FunctionData> BindApplyWith(ClientContext &context, ScalarFunction &bound_function,
-                                              vector<unique_ptr<Expression>> &arguments) {
-	auto bind_data = make_uniq<ApplyWithBindData>();
-	bound_function.return_type = LogicalType::VARCHAR;
+static FuncApplyMemoConfig &GetMemoConfig(ClientContext &context) {
+	return *context.registered_state->GetOrCreate<FuncApplyMemoConfig>("func_apply_memo_config");
+}
 
-	if (arguments.empty()) {
-		throw InvalidInputException("apply_with requires at least a function name");
+// Compare row left_sel[i] of `left` with row right_sel[i] of `right` for i < count, column by
+// column. Positions whose rows are not distinct go to `match`, the others to `no_match`.
+static idx_t MatchMemoRows(DataChunk &left, const SelectionVector &left_sel, DataChunk &right,
+                           const SelectionVector &right_sel, idx_t count, SelectionVector &match,
+                           SelectionVector &no_match, idx_t &no_match_count) {
+	for (idx_t i = 0; i < count; i++) {
+		match.set_index(i, i);
 	}
-
-	// First argument is always the function name
-	// Remaining arguments can be positional (args, kwargs) or named (args := ..., kwargs := ...)
-	for (idx_t i = 1; i < arguments.size(); i++) {
-		auto &alias = arguments[i]->alias;
-		if (alias == "args") {
-			bind_data->args_idx = i;
-		} else if (alias == "kwargs") {
-			bind_data->kwargs_idx = i;
-			bind_data->has_kwargs = true;
-		} else if (i == 1) {
-			// Positional: first extra arg is args
-			bind_data->args_idx = i;
-		} else if (i == 2) {
-			// Positional: second extra arg is kwargs
-			bind_data->kwargs_idx = i;
-			bind_data->has_kwargs = true;
+	idx_t match_count = count;
+	SelectionVector remaining(count);
+	SelectionVector different(count);
+	for (idx_t c = 0; c < left.ColumnCount() && match_count > 0; c++) {
+		Vector left_column(left.data[c], left_sel, count);
+		Vector right_column(right.data[c], right_sel, count);
+		for (idx_t i = 0; i < match_count; i++) {
+			remaining.set_index(i, match.get_index(i));
 		}
-	}
-
-	// Try to infer return type if function name is constant
-	if (arguments[0]->IsFoldable()) {
-		Value func_name_val = ExpressionExecutor::EvaluateScalar(context, *arguments[0]);
-		if (!func_name_val.IsNull()) {
-			string func_name = StringValue::Get(func_name_val);
-			if (IsValidIdentifier(func_name)) {
-				auto func_type = GetCallableFunctionType(context, func_name);
-				if (func_type == CatalogType::SCALAR_FUNCTION_ENTRY) {
-					auto &catalog = Catalog::GetSystemCatalog(context);
-					auto func_entry = catalog.GetEntry<ScalarFunctionCatalogEntry>(context, DEFAULT_SCHEMA, func_name,
-					                                                               OnEntryNotFound::RETURN_NULL);
-					if (func_entry && !func_entry->functions.functions.empty()) {
-						auto &first_func = func_entry->functions.functions[0];
-						if (first_func.return_type.id() != LogicalTypeId::ANY) {
-							bound_function.return_type = first_func.return_type;
-						}
-					}
-				}
-			}
+		auto compared = match_count;
+		match_count =
+		    VectorOperations::NotDistinctFrom(left_column, right_column, &remaining, compared, &match, &different);
+		for (idx_t i = 0; i < compared - match_count; i++) {
+			no_match.set_index(no_match_count++, different.get_index(i));
 		}
 	}
-
-	return std::move(bind_data);
+	return match_count;
 }
 
-static void ApplyWithScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
-	auto &context = state.GetContext();
-	auto &bind_data = state.expr.Cast<BoundFunctionExpression>().bind_info->Cast<ApplyWithBindData>();
-	idx_t count = args.size();
+// Results of one bound target for recent argument tuples (per thread). Argument tuples and
+// their results are kept in chunks, found by hash and checked by value a chunk at a time.
+class ApplyMemo {
+public:
+	ApplyMemo(idx_t capacity_p, shared_ptr<ApplyMemoCounters> counters_p)
+	    : capacity(capacity_p), counters(std::move(counters_p)) {
+	}
 
-	for (idx_t i = 0; i < count; i++) {
-		// Get function name
-		auto func_name_val = args.data[0].GetValue(i);
-		if (func_name_val.IsNull()) {
-			result.SetValue(i, Value());
-			continue;
+	// Evaluate `executor` over `input` into `result`, computing only the rows whose argument
+	// tuple is not remembered, once per distinct tuple. Returns the number of rows not computed.
+	idx_t Execute(ExpressionExecutor &executor, DataChunk &input, Vector &result) {
+		auto count = input.size();
+		Vector hashes(LogicalType::HASH, count);
+		VectorOperations::Hash(input.data[0], hashes, count);
+		for (idx_t c = 1; c < input.ColumnCount(); c++) {
+			VectorOperations::CombineHash(hashes, input.data[c], count);
+		}
+		UnifiedVectorFormat hash_data;
+		hashes.ToUnifiedFormat(count, hash_data);
+		auto hash_values = UnifiedVectorFormat::GetData<hash_t>(hash_data);
+		if (types.empty()) {
+			types = input.GetTypes();
+			types.push_back(result.GetType());
 		}
 
-		string func_name = StringValue::Get(func_name_val);
-
-		// Validate function name
-		if (!IsValidIdentifier(func_name)) {
-			throw InvalidInputException("apply_with: invalid function name '%s'", func_name);
+		// Rows whose hash is remembered are probed against their slot, the others are misses
+		vector<pair<idx_t, idx_t>> probes;
+		SelectionVector miss_rows(count);
+		idx_t miss_count = 0;
+		for (idx_t row = 0; row < count; row++) {
+			auto entry = slots.find(hash_values[hash_data.sel->get_index(row)]);
+			if (entry == slots.end()) {
+				miss_rows.set_index(miss_count++, row);
+			} else {
+				probes.emplace_back(entry->second, row);
+			}
 		}
 
-		// Get args list
-		Value args_list;
-		if (bind_data.args_idx < args.ColumnCount()) {
-			args_list = args.data[bind_data.args_idx].GetValue(i);
+		// Verify the probes a memo chunk at a time and copy the results of those that match
+		// to the front of `staging`; `gather` maps each row to its result in `staging`
+		Vector staging(result.GetType(), count);
+		SelectionVector gather(count);
+		idx_t hit_count = 0;
+		if (!probes.empty()) {
+			std::sort(probes.begin(), probes.end());
+			SelectionVector block_rows(count);
+			SelectionVector block_slots(count);
+			SelectionVector match(count);
+			SelectionVector no_match(count);
+			for (idx_t begin = 0; begin < probes.size();) {
+				auto block_idx = probes[begin].first / STANDARD_VECTOR_SIZE;
+				idx_t block_count = 0;
+				for (; begin < probes.size() && probes[begin].first / STANDARD_VECTOR_SIZE == block_idx; begin++) {
+					block_rows.set_index(block_count, probes[begin].second);
+					block_slots.set_index(block_count++, probes[begin].first % STANDARD_VECTOR_SIZE);
+				}
+				auto &block = *blocks[block_idx];
+				idx_t no_match_count = 0;
+				auto match_count = MatchMemoRows(input, block_rows, block, block_slots, block_count, match, no_match,
+				                                 no_match_count);
+				for (idx_t i = 0; i < no_match_count; i++) {
+					miss_rows.set_index(miss_count++, block_rows.get_index(no_match.get_index(i)));
+				}
+				SelectionVector hit_slots(match_count);
+				for (idx_t i = 0; i < match_count; i++) {
+					hit_slots.set_index(i, block_slots.get_index(match.get_index(i)));
+					gather.set_index(block_rows.get_index(match.get_index(i)), hit_count + i);
+				}
+				VectorOperations::Copy(block.data.back(), staging, hit_slots, match_count, 0, hit_count);
+				hit_count += match_count;
+			}
 		}
 
-		// Collect positional args from list
-		vector<Value> func_args;
-		if (!args_list.IsNull() && args_list.type().id() == LogicalTypeId::LIST) {
-			auto &list_children = ListValue::GetChildren(args_list);
-			for (auto &child : list_children) {
-				func_args.push_back(child);
+		// Misses repeating an earlier miss of this chunk are computed once
+		SelectionVector compute_rows(count);
+		vector<hash_t> compute_hashes;
+		unordered_map<hash_t, idx_t> first_miss;
+		SelectionVector repeat_rows(count);
+		SelectionVector repeat_of(count);
+		idx_t repeat_count = 0;
+		for (idx_t i = 0; i < miss_count; i++) {
+			auto row = miss_rows.get_index(i);
+			auto hash = hash_values[hash_data.sel->get_index(row)];
+			auto first = first_miss.find(hash);
+			if (first != first_miss.end()) {
+				repeat_rows.set_index(repeat_count, row);
+				repeat_of.set_index(repeat_count++, compute_rows.get_index(first->second));
+				continue;
+			}
+			first_miss[hash] = compute_hashes.size();
+			compute_rows.set_index(compute_hashes.size(), row);
+			compute_hashes.push_back(hash);
+		}
+		idx_t repeat_hits = 0;
+		SelectionVector repeat_match(count);
+		if (repeat_count > 0) {
+			SelectionVector no_match(count);
+			idx_t no_match_count = 0;
+			repeat_hits = MatchMemoRows(input, repeat_rows, input, repeat_of, repeat_count, repeat_match, no_match,
+			                            no_match_count);
+			// A repeated hash with different arguments is computed on its own
+			for (idx_t i = 0; i < no_match_count; i++) {
+				auto row = repeat_rows.get_index(no_match.get_index(i));
+				compute_rows.set_index(compute_hashes.size(), row);
+				compute_hashes.push_back(hash_values[hash_data.sel->get_index(row)]);
 			}
 		}
 
-		// Get kwargs if provided
-		if (bind_data.has_kwargs && bind_data.kwargs_idx < args.ColumnCount()) {
-			auto kwargs_struct = args.data[bind_data.kwargs_idx].GetValue(i);
-			if (!kwargs_struct.IsNull() && kwargs_struct.type().id() == LogicalTypeId::STRUCT) {
-				auto &struct_children = StructValue::GetChildren(kwargs_struct);
-				if (!struct_children.empty()) {
-					throw InvalidInputException("apply_with: kwargs (named parameters) are not yet supported. "
-					                            "Use positional args instead.");
-				}
+		auto compute_count = compute_hashes.size();
+		counters->hits += hit_count + repeat_hits;
+		counters->misses += compute_count;
+		if (compute_count > 0) {
+			DataChunk computed;
+			computed.InitializeEmpty(input.GetTypes());
+			computed.Slice(input, compute_rows, compute_count);
+			Vector computed_result(result.GetType(), compute_count);
+			executor.ExecuteExpression(computed, computed_result);
+			VectorOperations::Copy(computed_result, staging, compute_count, 0, hit_count);
+			for (idx_t k = 0; k < compute_count; k++) {
+				gather.set_index(compute_rows.get_index(k), hit_count + k);
+			}
+			// A repeat takes the result of the row it repeats
+			for (idx_t i = 0; i < repeat_hits; i++) {
+				auto position = repeat_match.get_index(i);
+				gather.set_index(repeat_rows.get_index(position), gather.get_index(repeat_of.get_index(position)));
 			}
+			Remember(computed, computed_result, compute_hashes);
 		}
+		result.SetVectorType(VectorType::FLAT_VECTOR);
+		VectorOperations::Copy(staging, result, gather, count, 0, 0);
+		return hit_count + repeat_hits;
+	}
 
-		// Execute the function
-		try {
-			auto val = ExecuteFunction(context, func_name, func_args);
-			result.SetValue(i, val);
-		} catch (const Exception &e) {
-			throw InvalidInputException("apply_with('%s'): %s", func_name, e.what());
+private:
+	// Append computed tuples and their results, emptying the memo first if they do not fit
+	void Remember(DataChunk &args, Vector &results, const vector<hash_t> &hashes) {
+		if (stored + args.size() > capacity) {
+			blocks.clear();
+			slots.clear();
+			stored = 0;
+		}
+		auto remember_count = MinValue<idx_t>(args.size(), capacity - stored);
+		idx_t done = 0;
+		while (done < remember_count) {
+			if (blocks.empty() || blocks.back()->size() == STANDARD_VECTOR_SIZE) {
+				blocks.push_back(make_uniq<DataChunk>());
+				blocks.back()->Initialize(Allocator::DefaultAllocator(), types);
+			}
+			auto &block = *blocks.back();
+			auto block_offset = block.size();
+			auto part = MinValue<idx_t>(remember_count - done, STANDARD_VECTOR_SIZE - block_offset);
+			for (idx_t c = 0; c < args.ColumnCount(); c++) {
+				VectorOperations::Copy(args.data[c], block.data[c], done + part, done, block_offset);
+			}
+			VectorOperations::Copy(results, block.data.back(), done + part, done, block_offset);
+			block.SetCardinality(block_offset + part);
+			for (idx_t i = 0; i < part; i++) {
+				slots[hashes[done + i]] = stored + i;
+			}
+			stored += part;
+			done += part;
 		}
 	}
-}
+
+	idx_t capacity;
+	shared_ptr<ApplyMemoCounters> counters;
+	// Argument columns followed by the result column
+	vector<LogicalType> types;
+	// Remembered tuples, STANDARD_VECTOR_SIZE per chunk: slot s is row s % STANDARD_VECTOR_SIZE of
+	// chunk s / STANDARD_VECTOR_SIZE
+	vector<unique_ptr<DataChunk>> blocks;
+	// Slot of the latest tuple remembered per hash
+	unordered_map<hash_t, idx_t> slots;
+	idx_t stored = 0;
+};
 
 //===--------------------------------------------------------------------===//
-// apply_table(func VARCHAR, ...args ANY) -> TABLE
+// Call statistics
 //===--------------------------------------------------------------------===//
+//
+// Every thread counts, per target function and execution strategy, the vectorized calls it
+// made, their rows, the time spent binding and executing targets, memoization hits and
+// misses, and rows blocked by the security policy. The counters are plain integers in the
+// thread's ApplyLocalState and are merged into the session's totals when the state is
+// destroyed, at the end of the query, so they cost a clock read per vectorized call. See
+// func_apply_stats().
+//
+// Strategies, also reported per expression by func_apply_explain():
+//   - prebound: bound when the query is bound (candidates, constant chains and expressions)
+//   - constant: constant name, bound once per thread on first use
+//   - grouped:  names vary per row; rows are grouped by name in each chunk
+// Groups of try_apply / try_apply_with / apply_result that fail are re-run in halves until
+// the failing rows are found; every re-run row is counted in fallback_rows.
+
+struct ApplyCallStats {
+	// Target kind: function, macro, chain or expression
+	string kind;
+	idx_t calls = 0;
+	idx_t rows = 0;
+	idx_t fallback_rows = 0;
+	idx_t bind_ns = 0;
+	idx_t exec_ns = 0;
+	idx_t memo_hits = 0;
+	idx_t memo_misses = 0;
+	idx_t blocked_rows = 0;
+
+	void Merge(const ApplyCallStats &other) {
+		kind = other.kind;
+		calls += other.calls;
+		rows += other.rows;
+		fallback_rows += other.fallback_rows;
+		bind_ns += other.bind_ns;
+		exec_ns += other.exec_ns;
+		memo_hits += other.memo_hits;
+		memo_misses += other.memo_misses;
+		blocked_rows += other.blocked_rows;
+	}
+};
 
-// Helper function to parse a query into a SubqueryRef
-static unique_ptr<SubqueryRef> ParseSubquery(const string &query, const ParserOptions &options) {
-	Parser parser(options);
-	parser.ParseQuery(query);
-	if (parser.statements.size() != 1 || parser.statements[0]->type != StatementType::SELECT_STATEMENT) {
-		throw BinderException("apply_table: expected a single SELECT statement from generated query");
+// Statistics by function name and strategy
+using ApplyStatsMap = map<pair<string, string>, ApplyCallStats>;
+
+// Merged statistics of a session, registered on the connection so they go away with it.
+// Threads merge into it concurrently when their states are destroyed.
+class ApplySessionStats : public ClientContextState {
+public:
+	void Merge(const ApplyStatsMap &stats) {
+		lock_guard<mutex> guard(lock);
+		for (auto &entry : stats) {
+			entries[entry.first].Merge(entry.second);
+		}
 	}
-	auto select_stmt = unique_ptr_cast<SQLStatement, SelectStatement>(std::move(parser.statements[0]));
-	return make_uniq<SubqueryRef>(std::move(select_stmt));
-}
 
-// bind_replace for apply_table: generates SQL and replaces with subquery
-static unique_ptr<TableRef> ApplyTableBindReplace(ClientContext &context, TableFunctionBindInput &input) {
-	// First argument is the function name
-	if (input.inputs.empty()) {
-		throw BinderException("apply_table requires at least a function name");
+	ApplyStatsMap Get() {
+		lock_guard<mutex> guard(lock);
+		return entries;
 	}
 
-	auto &func_name_val = input.inputs[0];
-	if (func_name_val.IsNull()) {
-		throw BinderException("apply_table: function name cannot be NULL");
+	void Reset() {
+		lock_guard<mutex> guard(lock);
+		entries.clear();
 	}
 
-	string func_name = StringValue::Get(func_name_val);
+private:
+	mutex lock;
+	ApplyStatsMap entries;
+};
 
-	// Validate function name
-	if (!IsValidIdentifier(func_name)) {
-		throw BinderException("apply_table: invalid function name '%s'", func_name);
-	}
+static ApplySessionStats &GetSessionStats(ClientContext &context) {
+	return *context.registered_state->GetOrCreate<ApplySessionStats>("func_apply_call_stats");
+}
 
-	// Security check - collect args for validation
-	vector<Value> args_for_validation;
-	for (idx_t i = 1; i < input.inputs.size(); i++) {
-		args_for_validation.push_back(input.inputs[i]);
-	}
+static idx_t ElapsedNanos(std::chrono::steady_clock::time_point start) {
+	auto elapsed = std::chrono::steady_clock::now() - start;
+	return NumericCast<idx_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
 
-	// Validate against security policy (will throw if on_block = "error")
+// Interrupts, internal errors and security blocks abort the query in every error mode
+static bool IsApplyRowError(const ErrorData &error) {
+	switch (error.Type()) {
+	case ExceptionType::INTERRUPT:
+	case ExceptionType::FATAL:
+	case ExceptionType::INTERNAL:
+	case ExceptionType::PERMISSION:
+		return false;
+	default:
+		return true;
+	}
+}
+
+// Input columns bound into a target as constants, by column index
+using ApplyConstantInputs = map<idx_t, Value>;
+
+// Cache key of constant inputs. Values are keyed with their type, so 1 and 1.0 bind apart.
+static string GetConstantInputsKey(const ApplyConstantInputs &constants) {
+	string key;
+	for (auto &entry : constants) {
+		key += to_string(entry.first) + "=" + entry.second.type().ToString() + ":" + entry.second.ToSQLString() + ",";
+	}
+	return key;
+}
+
+struct ApplyValueTargets;
+
+// A target bound for one argument layout, with its executor (per thread)
+struct ApplyBoundTarget {
+	bool blocked = false;
+	Value blocked_value;
+	unique_ptr<Expression> expr;
+	unique_ptr<ExpressionExecutor> executor;
+	// Constant partial() descriptor bound into expr, owned by the bind data
+	optional_ptr<const ApplyPartial> partial;
+	// Remembered results, when memoization is on for the session (not copied)
+	unique_ptr<ApplyMemo> memo;
+	// Name the statistics are kept under (lower-cased function name, chain, or apply_expr
+	// text), the target's kind, and the thread's counters for it
+	string stats_name;
+	string kind;
+	optional_ptr<ApplyCallStats> stats;
+	// Set instead of expr when the arguments do not bind as references, see ApplyValueTargets.
+	// Only targets bound on first use have it, so it is not copied.
+	shared_ptr<ApplyValueTargets> by_value;
+
+	// Copy of the bound target with an executor of its own
+	unique_ptr<ApplyBoundTarget> Copy(ClientContext &context) const {
+		auto result = make_uniq<ApplyBoundTarget>();
+		result->blocked = blocked;
+		result->blocked_value = blocked_value;
+		result->partial = partial;
+		result->stats_name = stats_name;
+		result->kind = kind;
+		if (expr) {
+			result->expr = expr->Copy();
+			result->executor = make_uniq<ExpressionExecutor>(context, *result->expr);
+		}
+		return result;
+	}
+};
+
+// Security-check and bind a target for one argument layout (without an executor). With a
+// partial() descriptor, its fixed arguments are bound in ahead of the inputs. Inputs listed in
+// `constants` are bound as those values instead of as references.
+static unique_ptr<ApplyBoundTarget> MakeApplyTarget(ClientContext &context, const string &func_name,
+                                                    const vector<LogicalType> &input_types, idx_t positional_count,
+                                                    const vector<string> &named,
+                                                    optional_ptr<const ApplyPartial> partial = nullptr,
+                                                    const ApplyConstantInputs &constants = {}) {
+	auto target = make_uniq<ApplyBoundTarget>();
+	target->stats_name = StringUtil::Lower(func_name);
+	target->kind = GetCallableFunctionType(context, func_name) == CatalogType::MACRO_ENTRY ? "macro" : "function";
+	target->partial = partial;
+	// Blacklist/whitelist decisions depend only on the name; in validator mode each row
+	// is checked with its own arguments before it reaches the target
+	if (GetSecurityConfig(context).mode != "validator" && !ValidateFunctionCall(context, func_name, {})) {
+		target->blocked = true;
+		target->blocked_value = GetBlockedValue(context);
+	} else {
+		auto arguments = partial ? ResolvePartialArguments(context, *partial, positional_count, named)
+		                         : ResolveApplyArguments(context, func_name, positional_count, named);
+		for (auto &argument : arguments) {
+			auto constant = constants.find(argument.input_index);
+			if (!argument.fixed && constant != constants.end()) {
+				argument.fixed = true;
+				argument.fixed_value = constant->second;
+			}
+		}
+		target->expr = BindApplyTarget(context, func_name, input_types, arguments);
+	}
+	return target;
+}
+
+// Targets of an argument layout that does not bind against argument references, because the
+// function needs some arguments to be constant (the format of strftime, the key of
+// struct_extract, the precision of round on a DECIMAL). Each group of rows is bound with the
+// columns that hold a single value in the group as constants; if that does not bind either,
+// each row is bound with all of its arguments as constants. Targets are kept per constant
+// values, up to a bound, so repeated values are bound once.
+struct ApplyValueTargets {
+	static constexpr idx_t CAPACITY = 1024;
+
+	ApplyValueTargets(ClientContext &context_p, string func_name_p, vector<LogicalType> input_types_p,
+	                  idx_t positional_count_p, vector<string> named_p, optional_ptr<const ApplyPartial> partial_p)
+	    : context(context_p), func_name(std::move(func_name_p)), input_types(std::move(input_types_p)),
+	      positional_count(positional_count_p), named(std::move(named_p)), partial(partial_p) {
+	}
+
+	// The target binding `constants`. When some inputs are still references and it does not
+	// bind, returns nullptr; with every input constant, binding errors are thrown.
+	optional_ptr<ApplyBoundTarget> Get(const ApplyConstantInputs &constants, optional_ptr<ApplyCallStats> stats) {
+		auto key = GetConstantInputsKey(constants);
+		auto it = targets.find(key);
+		if (it != targets.end()) {
+			return it->second.get();
+		}
+		auto start = std::chrono::steady_clock::now();
+		unique_ptr<ApplyBoundTarget> target;
+		try {
+			target = MakeApplyTarget(context, func_name, input_types, positional_count, named, partial, constants);
+			if (target->expr) {
+				target->executor = make_uniq<ExpressionExecutor>(context, *target->expr);
+			}
+			target->stats = stats;
+		} catch (std::exception &ex) {
+			ErrorData error(ex);
+			if (!IsApplyRowError(error) || constants.size() == input_types.size()) {
+				throw;
+			}
+		}
+		if (stats) {
+			stats->bind_ns += ElapsedNanos(start);
+		}
+		if (targets.size() >= CAPACITY) {
+			targets.clear();
+		}
+		auto result = target.get();
+		targets[key] = std::move(target);
+		return result;
+	}
+
+private:
+	ClientContext &context;
+	string func_name;
+	vector<LogicalType> input_types;
+	idx_t positional_count;
+	vector<string> named;
+	optional_ptr<const ApplyPartial> partial;
+	// Bound targets by constant values; nullptr where binding failed
+	unordered_map<string, unique_ptr<ApplyBoundTarget>> targets;
+};
+
+// Security-check and bind a chain of calls, names[0](inputs...) then each following name on
+// the previous result, as one fused target. In validator mode the fused target only serves to
+// infer the result type: chains then run stage by stage so each call is validated on its own.
+static unique_ptr<ApplyBoundTarget> MakeApplyChainTarget(ClientContext &context, const vector<string> &names,
+                                                         const vector<LogicalType> &input_types) {
+	auto target = make_uniq<ApplyBoundTarget>();
+	target->stats_name = StringUtil::Lower(StringUtil::Join(names, " > "));
+	target->kind = "chain";
+	if (GetSecurityConfig(context).mode != "validator") {
+		for (auto &func_name : names) {
+			if (!ValidateFunctionCall(context, func_name, {})) {
+				target->blocked = true;
+				target->blocked_value = GetBlockedValue(context);
+				return target;
+			}
+		}
+	}
+	auto arguments = ResolveApplyArguments(context, names[0], input_types.size(), {});
+	vector<string> then(names.begin() + 1, names.end());
+	target->expr = BindApplyTarget(context, names[0], input_types, arguments, then);
+	return target;
+}
+
+// Turn the $n placeholders of a parsed apply_expr expression into argument references, and
+// collect the functions it calls. Operators are not collected: they are not subject to the
+// security policy, like in a direct call.
+static void PrepareApplyExpression(unique_ptr<ParsedExpression> &expr, idx_t arg_count, vector<string> &functions) {
+	switch (expr->GetExpressionClass()) {
+	case ExpressionClass::PARAMETER: {
+		auto &identifier = expr->Cast<ParameterExpression>().identifier;
+		if (identifier.empty() || identifier.size() > 9 || identifier.find_first_not_of("0123456789") != string::npos ||
+		    std::stoull(identifier) == 0) {
+			throw InvalidInputException("placeholders must be $1, $2, ..., got $%s", identifier);
+		}
+		idx_t number = std::stoull(identifier);
+		if (number > arg_count) {
+			throw InvalidInputException("$%d is used but only %d arguments were given", number, arg_count);
+		}
+		expr = MakeArgumentReference(number - 1);
+		return;
+	}
+	case ExpressionClass::SUBQUERY:
+		throw InvalidInputException("subqueries are not allowed");
+	case ExpressionClass::FUNCTION: {
+		auto &function = expr->Cast<FunctionExpression>();
+		if (!function.is_operator) {
+			functions.push_back(function.function_name);
+		}
+		break;
+	}
+	default:
+		break;
+	}
+	ParsedExpressionIterator::EnumerateChildren(*expr, [&](unique_ptr<ParsedExpression> &child) {
+		PrepareApplyExpression(child, arg_count, functions);
+	});
+}
+
+// Parse, security-check and bind an apply_expr expression (without an executor). Every
+// function in the expression is checked by name; in validator mode, without argument values.
+static unique_ptr<ApplyBoundTarget> MakeApplyExprTarget(ClientContext &context, const string &expr_text,
+                                                        const vector<LogicalType> &input_types) {
+	auto expressions = Parser::ParseExpressionList(expr_text, context.GetParserOptions());
+	if (expressions.size() != 1) {
+		throw InvalidInputException("expected a single expression, got %d", expressions.size());
+	}
+	auto expr = std::move(expressions[0]);
+	vector<string> functions;
+	PrepareApplyExpression(expr, input_types.size(), functions);
+
+	auto target = make_uniq<ApplyBoundTarget>();
+	target->stats_name = expr_text;
+	target->kind = "expression";
+	for (auto &func_name : functions) {
+		if (!ValidateFunctionCall(context, func_name, {})) {
+			target->blocked = true;
+			target->blocked_value = GetBlockedValue(context);
+			return target;
+		}
+	}
+	target->expr = BindApplyExpression(context, input_types, std::move(expr));
+	return target;
+}
+
+// Per-thread cache of bound targets, keyed by name and argument layout
+struct ApplyLocalState : public FunctionLocalState {
+	ApplyLocalState(ClientContext &context_p, string strategy_p) : context(context_p), strategy(std::move(strategy_p)) {
+	}
+
+	~ApplyLocalState() override {
+		// Merge this thread's statistics into the session's
+		if (stats.empty()) {
+			return;
+		}
+		GetSessionStats(context).Merge(stats);
+	}
+
+	ClientContext &context;
+	// Strategy of targets bound on first use: constant or grouped
+	string strategy;
+	unordered_map<string, unique_ptr<ApplyBoundTarget>> targets;
+	// Copies of targets bound at bind time, indexed like the bound set
+	vector<unique_ptr<ApplyBoundTarget>> prebound;
+	// This thread's statistics
+	ApplyStatsMap stats;
+
+	ApplyBoundTarget &GetPrebound(const vector<unique_ptr<ApplyBoundTarget>> &bound, idx_t idx) {
+		if (prebound.size() < bound.size()) {
+			prebound.resize(bound.size());
+		}
+		if (!prebound[idx]) {
+			auto start = std::chrono::steady_clock::now();
+			prebound[idx] = bound[idx]->Copy(context);
+			Attach(*prebound[idx], "prebound", start);
+		}
+		return *prebound[idx];
+	}
+
+	// Inputs are positional_count positional arguments followed by one column per named argument.
+	// A partial() descriptor is constant for the expression that owns this state, so it is not
+	// part of the key. Inputs in `constants` are bound as their values, which are part of the
+	// key. A layout that does not bind against references, because the function needs constant
+	// arguments, gets a target that binds by value.
+	ApplyBoundTarget &GetTarget(const string &func_name, const vector<LogicalType> &input_types,
+	                            idx_t positional_count, const vector<string> &named,
+	                            optional_ptr<const ApplyPartial> partial = nullptr,
+	                            const ApplyConstantInputs &constants = {}) {
+		auto key = StringUtil::Lower(func_name) + "(";
+		for (idx_t i = 0; i < input_types.size(); i++) {
+			key += (i < positional_count ? string() : named[i - positional_count] + ":=") + input_types[i].ToString();
+			key += ",";
+		}
+		key += ")" + GetConstantInputsKey(constants);
+		auto it = targets.find(key);
+		if (it != targets.end()) {
+			return *it->second;
+		}
+		return AddTarget(key, [&]() {
+			try {
+				return MakeApplyTarget(context, func_name, input_types, positional_count, named, partial, constants);
+			} catch (std::exception &ex) {
+				ErrorData error(ex);
+				if (!IsApplyRowError(error) || constants.size() == input_types.size()) {
+					throw;
+				}
+				// A name that does not resolve fails here rather than on every row
+				CheckApplyTargetName(context, func_name);
+				auto target = make_uniq<ApplyBoundTarget>();
+				target->stats_name = StringUtil::Lower(func_name);
+				target->kind =
+				    GetCallableFunctionType(context, func_name) == CatalogType::MACRO_ENTRY ? "macro" : "function";
+				target->by_value = make_shared_ptr<ApplyValueTargets>(context, func_name, input_types,
+				                                                      positional_count, named, partial);
+				return target;
+			}
+		});
+	}
+
+	// A chain of calls fused into one target, cached alongside single calls
+	ApplyBoundTarget &GetChainTarget(const vector<string> &names, const vector<LogicalType> &input_types) {
+		// Valid function names cannot contain '>', so chain keys never collide with call keys
+		auto key = StringUtil::Lower(StringUtil::Join(names, ">")) + "(";
+		for (auto &type : input_types) {
+			key += type.ToString() + ",";
+		}
+		key += ")";
+		auto it = targets.find(key);
+		if (it != targets.end()) {
+			return *it->second;
+		}
+		return AddTarget(key, [&]() { return MakeApplyChainTarget(context, names, input_types); });
+	}
+
+	// An apply_expr expression, parsed and bound once per text and argument types
+	ApplyBoundTarget &GetExprTarget(const string &expr_text, const vector<LogicalType> &input_types) {
+		// Prefixed with '$', which no function name starts with
+		auto key = "$" + expr_text + string(1, '\0');
+		for (auto &type : input_types) {
+			key += type.ToString() + ",";
+		}
+		auto it = targets.find(key);
+		if (it != targets.end()) {
+			return *it->second;
+		}
+		return AddTarget(key, [&]() { return MakeApplyExprTarget(context, expr_text, input_types); });
+	}
+
+private:
+	// Build a target with `make`, counting the time spent as bind time
+	template <class MAKE>
+	ApplyBoundTarget &AddTarget(const string &key, MAKE &&make) {
+		auto start = std::chrono::steady_clock::now();
+		auto target = make();
+		if (target->expr) {
+			target->executor = make_uniq<ExpressionExecutor>(context, *target->expr);
+		}
+		Attach(*target, strategy, start);
+		auto &result = *target;
+		targets[key] = std::move(target);
+		return result;
+	}
+
+	// Hook a new target up to this thread's statistics and, for targets whose results depend
+	// only on their arguments, to a memo
+	void Attach(ApplyBoundTarget &target, const string &target_strategy,
+	            std::chrono::steady_clock::time_point start) {
+		auto &config = GetMemoConfig(context);
+		if (config.enabled && target.expr && target.expr->IsConsistent()) {
+			target.memo = make_uniq<ApplyMemo>(config.capacity, config.counters);
+		}
+		target.stats = &stats[make_pair(target.stats_name, target_strategy)];
+		target.stats->kind = target.kind;
+		target.stats->bind_ns += ElapsedNanos(start);
+	}
+};
+
+static unique_ptr<FunctionLocalState> ApplyInitLocalState(ExpressionState &state, const BoundFunctionExpression &expr,
+                                                         FunctionData *bind_data) {
+	bool constant = !expr.children.empty() && expr.children[0]->IsFoldable();
+	return make_uniq<ApplyLocalState>(state.GetContext(), constant ? "constant" : "grouped");
+}
+
+// Whether every row of a vector holds the same value
+static bool HoldsSingleValue(Vector &vector, idx_t count) {
+	if (vector.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		return true;
+	}
+	auto first = vector.GetValue(0);
+	for (idx_t i = 1; i < count; i++) {
+		if (!Value::NotDistinctFrom(first, vector.GetValue(i))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Evaluate a target over one group of rows and write the results to rows
+// [offset, offset + count) of `output`, cast to its type. With `errors`, values that do not
+// cast are NULL and their message is written to `errors` instead of throwing. A by-value
+// target binds the group's single-valued columns as constants, or else each row's arguments.
+static void ExecuteApplyTarget(ApplyBoundTarget &target, DataChunk &input, Vector &output, idx_t offset,
+                               optional_ptr<Vector> errors = nullptr) {
+	auto count = input.size();
+	if (target.blocked) {
+		if (target.stats) {
+			target.stats->blocked_rows += count;
+		}
+		auto blocked_value = target.blocked_value.DefaultCastAs(output.GetType());
+		for (idx_t i = 0; i < count; i++) {
+			output.SetValue(offset + i, blocked_value);
+		}
+		return;
+	}
+	if (target.by_value) {
+		ApplyConstantInputs constants;
+		for (idx_t c = 0; c < input.ColumnCount(); c++) {
+			if (HoldsSingleValue(input.data[c], count)) {
+				constants[c] = input.GetValue(c, 0);
+			}
+		}
+		optional_ptr<ApplyBoundTarget> group_target;
+		if (!constants.empty()) {
+			group_target = target.by_value->Get(constants, target.stats);
+		}
+		if (group_target) {
+			ExecuteApplyTarget(*group_target, input, output, offset, errors);
+			return;
+		}
+		for (idx_t row = 0; row < count; row++) {
+			for (idx_t c = 0; c < input.ColumnCount(); c++) {
+				constants[c] = input.GetValue(c, row);
+			}
+			SelectionVector row_sel(1);
+			row_sel.set_index(0, row);
+			DataChunk row_input;
+			row_input.InitializeEmpty(input.GetTypes());
+			row_input.Slice(input, row_sel, 1);
+			ExecuteApplyTarget(*target.by_value->Get(constants, target.stats), row_input, output, offset + row,
+			                   errors);
+		}
+		return;
+	}
+	auto start = std::chrono::steady_clock::now();
+	Vector target_result(target.expr->return_type, count);
+	if (target.memo && input.ColumnCount() > 0) {
+		auto hits = target.memo->Execute(*target.executor, input, target_result);
+		if (target.stats) {
+			target.stats->memo_hits += hits;
+			target.stats->memo_misses += count - hits;
+		}
+	} else {
+		target.executor->ExecuteExpression(input, target_result);
+	}
+	if (target.stats) {
+		target.stats->calls++;
+		target.stats->rows += count;
+		target.stats->exec_ns += ElapsedNanos(start);
+	}
+	if (target_result.GetType() == output.GetType()) {
+		VectorOperations::Copy(target_result, output, count, 0, offset);
+		return;
+	}
+	Vector cast_result(output.GetType(), count);
+	if (!errors) {
+		VectorOperations::DefaultCast(target_result, cast_result, count);
+	} else {
+		string error_message;
+		if (!VectorOperations::DefaultTryCast(target_result, cast_result, count, &error_message)) {
+			// Rows that had a value but have no result are the ones that failed to cast
+			UnifiedVectorFormat source_data, cast_data;
+			target_result.ToUnifiedFormat(count, source_data);
+			cast_result.ToUnifiedFormat(count, cast_data);
+			for (idx_t i = 0; i < count; i++) {
+				if (source_data.validity.RowIsValid(source_data.sel->get_index(i)) &&
+				    !cast_data.validity.RowIsValid(cast_data.sel->get_index(i))) {
+					errors->SetValue(offset + i, Value(error_message));
+				}
+			}
+		}
+	}
+	VectorOperations::Copy(cast_result, output, count, 0, offset);
+}
+
+// Stands in for the member tag of a NULL element in a LIST of UNION args
+static constexpr idx_t APPLY_NULL_TAG = DConstants::INVALID_INDEX;
+
+// Rows of a chunk grouped by call: results are produced group by group into a staging
+// vector and moved into place with a single gather at the end
+class ApplyRowGroups {
+public:
+	struct Group {
+		Group(string func_name_p, idx_t arg_count_p, vector<idx_t> tags_p, idx_t fixed_count_p)
+		    : func_name(std::move(func_name_p)), arg_count(arg_count_p), tags(std::move(tags_p)),
+		      fixed_count(fixed_count_p), sel(STANDARD_VECTOR_SIZE) {
+		}
+
+		string func_name;
+		idx_t arg_count;
+		// Active member of each argument when args is a LIST of UNION, empty otherwise
+		vector<idx_t> tags;
+		// Number of fixed positional arguments read from a per-row partial() descriptor
+		idx_t fixed_count;
+		SelectionVector sel;
+		idx_t count = 0;
+	};
+
+	explicit ApplyRowGroups(idx_t count) : row_count(count) {
+	}
+
+	void Add(const string &func_name, idx_t arg_count, idx_t row, const vector<idx_t> &tags = {},
+	         idx_t fixed_count = 0) {
+		auto key = func_name + '\0' + to_string(arg_count) + '\0' + to_string(fixed_count) + '\0' +
+		           string(const_char_ptr_cast(tags.data()), tags.size() * sizeof(idx_t));
+		auto it = index.find(key);
+		if (it == index.end()) {
+			it = index.emplace(key, groups.size()).first;
+			groups.push_back(make_uniq<Group>(func_name, arg_count, tags, fixed_count));
+		}
+		auto &group = *groups[it->second];
+		group.sel.set_index(group.count++, row);
+	}
+
+	void AddNull(idx_t row) {
+		null_rows.push_back(row);
+	}
+
+	// Produce every group's results with `execute(group, output, errors, offset)`, then
+	// scatter. Error messages of failed rows are scattered to `errors` if given.
+	template <class EXECUTE>
+	void Execute(Vector &result, EXECUTE &&execute, optional_ptr<Vector> errors = nullptr) {
+		Vector staging(result.GetType(), row_count);
+		Vector error_staging(LogicalType::VARCHAR, row_count);
+		FlatVector::Validity(error_staging).SetAllInvalid(row_count);
+		SelectionVector gather(row_count);
+		idx_t offset = 0;
+		for (auto row : null_rows) {
+			FlatVector::SetNull(staging, offset, true);
+			gather.set_index(row, offset++);
+		}
+		for (auto &group : groups) {
+			execute(*group, staging, error_staging, offset);
+			for (idx_t i = 0; i < group->count; i++) {
+				gather.set_index(group->sel.get_index(i), offset + i);
+			}
+			offset += group->count;
+		}
+		result.SetVectorType(VectorType::FLAT_VECTOR);
+		VectorOperations::Copy(staging, result, gather, row_count, 0, 0);
+		if (errors) {
+			errors->SetVectorType(VectorType::FLAT_VECTOR);
+			VectorOperations::Copy(error_staging, *errors, gather, row_count, 0, 0);
+		}
+	}
+
+	vector<unique_ptr<Group>> groups;
+
+private:
+	idx_t row_count;
+	unordered_map<string, idx_t> index;
+	vector<idx_t> null_rows;
+};
+
+// Run one group of rows through its target. In validator mode every row is validated with
+// its own argument values first, and blocked rows produce the blocked value.
+static void ExecuteApplyGroup(ClientContext &context, ApplyBoundTarget &target, const string &func_name,
+                              DataChunk &input, idx_t positional_count, const vector<string> &named, Vector &output,
+                              idx_t offset, optional_ptr<Vector> errors = nullptr) {
+	if (GetSecurityConfig(context).mode != "validator") {
+		ExecuteApplyTarget(target, input, output, offset, errors);
+		return;
+	}
+
+	SelectionVector allowed(input.size());
+	idx_t allowed_count = 0;
+	for (idx_t row = 0; row < input.size(); row++) {
+		vector<Value> positional_args;
+		case_insensitive_map_t<Value> named_args;
+		if (target.partial) {
+			positional_args = target.partial->positional;
+			for (idx_t k = 0; k < target.partial->names.size(); k++) {
+				named_args[target.partial->names[k]] = target.partial->named[k];
+			}
+		}
+		for (idx_t c = 0; c < input.ColumnCount(); c++) {
+			if (c < positional_count) {
+				positional_args.push_back(input.GetValue(c, row));
+			} else {
+				named_args[named[c - positional_count]] = input.GetValue(c, row);
+			}
+		}
+		if (ValidateFunctionCall(context, func_name, positional_args, named_args)) {
+			allowed.set_index(allowed_count++, row);
+		} else {
+			output.SetValue(offset + row, GetBlockedValue(context).DefaultCastAs(output.GetType()));
+			if (target.stats) {
+				target.stats->blocked_rows++;
+			}
+		}
+	}
+	if (allowed_count == input.size()) {
+		ExecuteApplyTarget(target, input, output, offset, errors);
+		return;
+	}
+	if (allowed_count == 0) {
+		return;
+	}
+	DataChunk allowed_input;
+	allowed_input.InitializeEmpty(input.GetTypes());
+	allowed_input.Slice(input, allowed, allowed_count);
+	Vector allowed_output(output.GetType(), allowed_count);
+	Vector allowed_errors(LogicalType::VARCHAR, allowed_count);
+	FlatVector::Validity(allowed_errors).SetAllInvalid(allowed_count);
+	ExecuteApplyTarget(target, allowed_input, allowed_output, 0, errors ? &allowed_errors : nullptr);
+	for (idx_t i = 0; i < allowed_count; i++) {
+		auto row = offset + allowed.get_index(i);
+		output.SetValue(row, allowed_output.GetValue(i));
+		if (errors && FlatVector::Validity(allowed_errors).RowIsValid(i)) {
+			errors->SetValue(row, allowed_errors.GetValue(i));
+		}
+	}
+}
+
+// How a call reports rows that fail
+enum class ApplyErrorMode : uint8_t {
+	// The query fails (apply, apply_with)
+	THROW,
+	// Failing rows are NULL (try_apply, try_apply_with)
+	RETURN_NULL,
+	// Failing rows are NULL and their error message is kept (apply_result)
+	CAPTURE
+};
+
+// Mark rows [offset, offset + count) as failed
+static void SetApplyRowsFailed(Vector &output, Vector &errors, idx_t offset, idx_t count, const string &message) {
+	for (idx_t i = 0; i < count; i++) {
+		FlatVector::SetNull(output, offset + i, true);
+		errors.SetValue(offset + i, Value(message));
+	}
+}
+
+// Run `execute(input, offset)` for a group whose failures become NULL. The group runs as a
+// whole first; only if that throws is it split in halves and each half run the same way, so
+// the rows that fail are narrowed down in a few calls and the other rows keep their results.
+// Rows of a half that fails are evaluated again, so a volatile target (such as nextval) may
+// be evaluated more than once for them; halves that succeed are never re-run.
+template <class EXECUTE>
+static void ExecuteApplyRows(DataChunk &input, Vector &output, Vector &errors, idx_t offset,
+                             optional_ptr<ApplyCallStats> stats, EXECUTE &&execute) {
+	try {
+		execute(input, offset);
+		return;
+	} catch (std::exception &ex) {
+		ErrorData error(ex);
+		if (!IsApplyRowError(error)) {
+			throw;
+		}
+		if (input.size() == 1) {
+			SetApplyRowsFailed(output, errors, offset, 1, error.RawMessage());
+			return;
+		}
+	}
+	if (stats) {
+		stats->fallback_rows += input.size();
+	}
+	auto half = input.size() / 2;
+	for (auto &part : {make_pair(idx_t(0), half), make_pair(half, input.size())}) {
+		auto part_count = part.second - part.first;
+		SelectionVector part_sel(part_count);
+		for (idx_t i = 0; i < part_count; i++) {
+			part_sel.set_index(i, part.first + i);
+		}
+		DataChunk part_input;
+		part_input.InitializeEmpty(input.GetTypes());
+		part_input.Slice(input, part_sel, part_count);
+		ExecuteApplyRows(part_input, output, errors, offset + part.first, stats, execute);
+	}
+}
+
+// Remove the argument passed as `name := ...` from a call, or return nullptr if absent
+static unique_ptr<Expression> TakeNamedArgument(vector<unique_ptr<Expression>> &arguments, const string &name) {
+	for (idx_t i = 1; i < arguments.size(); i++) {
+		if (arguments[i]->alias == name) {
+			auto result = std::move(arguments[i]);
+			arguments.erase(arguments.begin() + NumericCast<int64_t>(i));
+			return result;
+		}
+	}
+	return nullptr;
+}
+
+// Consume a `returns := 'TYPE'` argument, the declared result type of a call whose target
+// may only be known at runtime. Each group's result is cast to it once, instead of every
+// row going through VARCHAR. Returns INVALID when the argument is absent.
+static LogicalType TakeReturnsArgument(ClientContext &context, const string &caller,
+                                       vector<unique_ptr<Expression>> &arguments) {
+	auto returns = TakeNamedArgument(arguments, "returns");
+	if (!returns) {
+		return LogicalType::INVALID;
+	}
+	if (!returns->IsFoldable()) {
+		throw BinderException("%s: returns must be a constant type name", caller);
+	}
+	auto type_name = ExpressionExecutor::EvaluateScalar(context, *returns);
+	if (type_name.IsNull() || type_name.type().id() != LogicalTypeId::VARCHAR) {
+		throw BinderException("%s: returns must be a type name such as 'DOUBLE'", caller);
+	}
+	return TransformStringToLogicalType(StringValue::Get(type_name), context);
+}
+
+//===--------------------------------------------------------------------===//
+// Candidate-set dispatch
+//===--------------------------------------------------------------------===//
+//
+// apply(name, ..., candidates := ['f', 'g', ...]) lists every function the call may
+// dispatch to. Each candidate is resolved, security-checked and bound once at bind time
+// against the argument types, so execution is a switch over pre-bound expressions with no
+// catalog access. Names outside the set are an error, or NULL with on_unknown := 'null'.
+
+struct ApplyCandidateSet {
+	// Name of the calling function, for error messages
+	string caller;
+	// Candidate names in the order given
+	vector<string> names;
+	case_insensitive_map_t<idx_t> index;
+	// Bound targets, indexed like names
+	vector<unique_ptr<ApplyBoundTarget>> targets;
+	bool unknown_is_null = false;
+};
+
+// Resolve and bind a list of candidate names for arguments of the given types
+static shared_ptr<ApplyCandidateSet> BindApplyCandidates(ClientContext &context, const string &caller,
+                                                         const Value &candidates,
+                                                         const vector<LogicalType> &input_types,
+                                                         const ApplyConstantInputs &constants = {}) {
+	auto names = candidates.IsNull() ? Value() : candidates.DefaultCastAs(LogicalType::LIST(LogicalType::VARCHAR));
+	if (names.IsNull() || ListValue::GetChildren(names).empty()) {
+		throw BinderException("%s: candidates must be a non-empty list of function names", caller);
+	}
+	auto result = make_shared_ptr<ApplyCandidateSet>();
+	result->caller = caller;
+	for (auto &name_val : ListValue::GetChildren(names)) {
+		if (name_val.IsNull()) {
+			throw BinderException("%s: candidates must not contain NULL", caller);
+		}
+		auto &func_name = StringValue::Get(name_val);
+		if (!IsValidIdentifier(func_name)) {
+			throw BinderException("%s: invalid function name '%s' in candidates", caller, func_name);
+		}
+		if (result->index.find(func_name) != result->index.end()) {
+			continue;
+		}
+		unique_ptr<ApplyBoundTarget> target;
+		try {
+			target = MakeApplyTarget(context, func_name, input_types, input_types.size(), {}, nullptr, constants);
+		} catch (const Exception &e) {
+			throw BinderException("%s: candidate '%s': %s", caller, func_name, e.what());
+		}
+		result->index[func_name] = result->names.size();
+		result->names.push_back(func_name);
+		result->targets.push_back(std::move(target));
+	}
+	return result;
+}
+
+// Common result type of the candidates: the type all of them cast to implicitly, otherwise a
+// UNION with one member per distinct result type, named after the type
+static LogicalType GetCandidateReturnType(ClientContext &context, const ApplyCandidateSet &candidates) {
+	vector<LogicalType> types;
+	for (auto &target : candidates.targets) {
+		if (target->expr && std::find(types.begin(), types.end(), target->expr->return_type) == types.end()) {
+			types.push_back(target->expr->return_type);
+		}
+	}
+	if (types.empty()) {
+		return LogicalType::VARCHAR;
+	}
+	auto result = types[0];
+	for (idx_t i = 1; i < types.size(); i++) {
+		if (!LogicalType::TryGetMaxLogicalType(context, result, types[i], result)) {
+			child_list_t<LogicalType> members;
+			for (auto &type : types) {
+				members.emplace_back(type.ToString(), type);
+			}
+			return LogicalType::UNION(std::move(members));
+		}
+	}
+	return result;
+}
+
+struct ApplyBindData : public FunctionData {
+	explicit ApplyBindData(shared_ptr<ApplyCandidateSet> candidates_p) : candidates(std::move(candidates_p)) {
+	}
+
+	// Bound targets are never modified after bind, so copies share them
+	shared_ptr<ApplyCandidateSet> candidates;
+
+	unique_ptr<FunctionData> Copy() const override {
+		return make_uniq<ApplyBindData>(candidates);
+	}
+	bool Equals(const FunctionData &other) const override {
+		auto &o = other.Cast<ApplyBindData>();
+		return candidates->caller == o.candidates->caller && candidates->names == o.candidates->names &&
+		       candidates->unknown_is_null == o.candidates->unknown_is_null;
+	}
+};
+
+// Parse on_unknown := 'error' | 'null'
+static bool GetUnknownIsNull(ClientContext &context, const string &caller, unique_ptr<Expression> on_unknown) {
+	if (!on_unknown) {
+		return false;
+	}
+	if (!on_unknown->IsFoldable()) {
+		throw BinderException("%s: on_unknown must be a constant", caller);
+	}
+	auto policy = ExpressionExecutor::EvaluateScalar(context, *on_unknown).ToString();
+	if (StringUtil::CIEquals(policy, "null")) {
+		return true;
+	}
+	if (!StringUtil::CIEquals(policy, "error")) {
+		throw BinderException("%s: on_unknown must be 'error' or 'null', got '%s'", caller, policy);
+	}
+	return false;
+}
+
+// Bind a call that dispatches over a candidate set; arguments[0] is the name
+static unique_ptr<FunctionData> BindApplyCandidateCall(ClientContext &context, const string &caller,
+                                                       ScalarFunction &bound_function,
+                                                       vector<unique_ptr<Expression>> &arguments,
+                                                       const Value &candidate_names, unique_ptr<Expression> on_unknown,
+                                                       const LogicalType &returns) {
+	vector<LogicalType> input_types;
+	ApplyConstantInputs constants;
+	for (idx_t i = 1; i < arguments.size(); i++) {
+		input_types.push_back(arguments[i]->return_type);
+		if (arguments[i]->IsFoldable()) {
+			constants[i - 1] = ExpressionExecutor::EvaluateScalar(context, *arguments[i]);
+		}
+	}
+	auto candidate_set = BindApplyCandidates(context, caller, candidate_names, input_types, constants);
+	candidate_set->unknown_is_null = GetUnknownIsNull(context, caller, std::move(on_unknown));
+	bound_function.return_type =
+	    returns.id() != LogicalTypeId::INVALID ? returns : GetCandidateReturnType(context, *candidate_set);
+	return make_uniq<ApplyBindData>(std::move(candidate_set));
+}
+
+//===--------------------------------------------------------------------===//
+// apply(func VARCHAR, ...args ANY) -> ANY
+//===--------------------------------------------------------------------===//
+
+static unique_ptr<FunctionData> BindApply(ClientContext &context, ScalarFunction &bound_function,
+                                          vector<unique_ptr<Expression>> &arguments) {
+	// Shared by apply, try_apply and apply_result
+	auto caller = bound_function.name;
+
+	// A declared return type takes precedence over inference
+	auto returns = TakeReturnsArgument(context, caller, arguments);
+	auto candidates = TakeNamedArgument(arguments, "candidates");
+	auto on_unknown = TakeNamedArgument(arguments, "on_unknown");
+	if (on_unknown && !candidates) {
+		throw BinderException("%s: on_unknown requires candidates", caller);
+	}
+	if (candidates) {
+		if (!candidates->IsFoldable()) {
+			throw BinderException("%s: candidates must be a constant list of function names", caller);
+		}
+		auto candidate_names = ExpressionExecutor::EvaluateScalar(context, *candidates);
+		return BindApplyCandidateCall(context, caller, bound_function, arguments, candidate_names,
+		                              std::move(on_unknown), returns);
+	}
+	if (returns.id() != LogicalTypeId::INVALID) {
+		bound_function.return_type = returns;
+		return nullptr;
+	}
+
+	// Default return type
+	bound_function.return_type = LogicalType::VARCHAR;
+
+	// If no arguments beyond function name, nothing to infer
+	if (arguments.empty()) {
+		return nullptr;
+	}
+
+	// Check if function name is a compile-time constant
+	if (!arguments[0]->IsFoldable()) {
+		return nullptr;
+	}
+
+	// Evaluate to get function name
+	Value func_name_val = ExpressionExecutor::EvaluateScalar(context, *arguments[0]);
+	if (func_name_val.IsNull()) {
+		return nullptr;
+	}
+	string func_name = StringValue::Get(func_name_val);
+
+	// Validate function name
+	if (!IsValidIdentifier(func_name)) {
+		return nullptr;
+	}
+
+	// Check the function type (only scalar functions and macros are callable via apply)
+	auto func_type = GetCallableFunctionType(context, func_name);
+
+	if (func_type == CatalogType::SCALAR_FUNCTION_ENTRY) {
+		// For scalar functions, use FunctionBinder directly
+		// FunctionBinder handles overload resolution and type coercion automatically
+		vector<unique_ptr<Expression>> target_args;
+		for (idx_t i = 1; i < arguments.size(); i++) {
+			target_args.push_back(arguments[i]->Copy());
+		}
+
+		ErrorData error;
+		FunctionBinder binder(context);
+		auto bound_expr = binder.BindScalarFunction(DEFAULT_SCHEMA, func_name, std::move(target_args), error);
+
+		if (error.HasError() || !bound_expr) {
+			return nullptr;
+		}
+
+		bound_function.return_type = bound_expr->return_type;
+		return nullptr;
+	}
+
+	if (func_type == CatalogType::MACRO_ENTRY) {
+		// For macros, use the full expression binding path
+		vector<unique_ptr<ParsedExpression>> parsed_args;
+		for (idx_t i = 1; i < arguments.size(); i++) {
+			// Try to evaluate constant expressions, otherwise create a placeholder
+			if (arguments[i]->IsFoldable()) {
+				auto val = ExpressionExecutor::EvaluateScalar(context, *arguments[i]);
+				parsed_args.push_back(make_uniq<ConstantExpression>(val));
+			} else {
+				// For non-constant expressions, we need to use the expression's type
+				// Create a constant with a dummy value of the right type
+				parsed_args.push_back(make_uniq<ConstantExpression>(Value(arguments[i]->return_type)));
+			}
+		}
+
+		unique_ptr<ParsedExpression> func_expr = make_uniq<FunctionExpression>(func_name, std::move(parsed_args));
+
+		try {
+			auto binder = Binder::CreateBinder(context);
+			ConstantBinder constant_binder(*binder, context, "apply");
+			auto bound_expr = constant_binder.Bind(func_expr);
+			bound_function.return_type = bound_expr->return_type;
+		} catch (...) {
+			// If binding fails, fall back to VARCHAR
+			return nullptr;
+		}
+
+		return nullptr;
+	}
+
+	// For other types, keep default VARCHAR
+	return nullptr;
+}
+
+static void ExecuteApplyCall(DataChunk &args, ExpressionState &state, Vector &result, ApplyErrorMode mode,
+                             optional_ptr<Vector> errors = nullptr) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<ApplyLocalState>();
+	optional_ptr<ApplyCandidateSet> candidates;
+	string caller = func_expr.function.name;
+	if (func_expr.bind_info) {
+		candidates = func_expr.bind_info->Cast<ApplyBindData>().candidates.get();
+		caller = candidates->caller;
+	}
+	idx_t count = args.size();
+	idx_t arg_count = args.ColumnCount() - 1;
+
+	UnifiedVectorFormat name_data;
+	args.data[0].ToUnifiedFormat(count, name_data);
+	auto names = UnifiedVectorFormat::GetData<string_t>(name_data);
+
+	// Every row has the same arguments, so rows are grouped by function name only
+	ApplyRowGroups groups(count);
+	for (idx_t i = 0; i < count; i++) {
+		auto name_idx = name_data.sel->get_index(i);
+		if (!name_data.validity.RowIsValid(name_idx)) {
+			groups.AddNull(i);
+			continue;
+		}
+		groups.Add(names[name_idx].GetString(), arg_count, i);
+	}
+
+	// Arguments that are constant in the query are bound into the target as constants, as in
+	// a direct call, so that functions that need constant arguments bind
+	vector<LogicalType> input_types;
+	ApplyConstantInputs constants;
+	for (idx_t c = 1; c < args.ColumnCount(); c++) {
+		input_types.push_back(args.data[c].GetType());
+		if (func_expr.children[c]->IsFoldable()) {
+			constants[c - 1] = args.data[c].GetValue(0);
+		}
+	}
+	// Resolve the target of a group: a pre-bound candidate, or bound on first use
+	auto get_target = [&](const string &func_name) -> optional_ptr<ApplyBoundTarget> {
+		if (candidates) {
+			// Pre-bound dispatch: the name only selects one of the candidates
+			auto entry = candidates->index.find(func_name);
+			if (entry == candidates->index.end()) {
+				if (!candidates->unknown_is_null) {
+					throw InvalidInputException("%s: function '%s' is not one of the candidates", caller, func_name);
+				}
+				return nullptr;
+			}
+			return lstate.GetPrebound(candidates->targets, entry->second);
+		}
+		if (!IsValidIdentifier(func_name)) {
+			throw InvalidInputException("%s: invalid function name '%s'", caller, func_name);
+		}
+		try {
+			return lstate.GetTarget(func_name, input_types, arg_count, {}, nullptr, constants);
+		} catch (const Exception &e) {
+			if (mode != ApplyErrorMode::THROW) {
+				throw;
+			}
+			throw InvalidInputException("%s('%s'): %s", caller, func_name, e.what());
+		}
+	};
+
+	groups.Execute(
+	    result,
+	    [&](ApplyRowGroups::Group &group, Vector &output, Vector &group_errors, idx_t offset) {
+		    auto &func_name = group.func_name;
+		    optional_ptr<ApplyBoundTarget> target;
+		    if (mode == ApplyErrorMode::THROW) {
+			    target = get_target(func_name);
+		    } else {
+			    // A name that cannot be resolved fails every row of its group
+			    try {
+				    target = get_target(func_name);
+			    } catch (std::exception &ex) {
+				    ErrorData error(ex);
+				    if (!IsApplyRowError(error)) {
+					    throw;
+				    }
+				    SetApplyRowsFailed(output, group_errors, offset, group.count, error.RawMessage());
+				    return;
+			    }
+		    }
+		    if (!target) {
+			    for (idx_t i = 0; i < group.count; i++) {
+				    FlatVector::SetNull(output, offset + i, true);
+			    }
+			    return;
+		    }
+
+		    DataChunk input;
+		    input.InitializeEmpty(input_types);
+		    for (idx_t c = 0; c < arg_count; c++) {
+			    input.data[c].Slice(args.data[c + 1], group.sel, group.count);
+		    }
+		    input.SetCardinality(group.count);
+		    if (mode == ApplyErrorMode::THROW) {
+			    try {
+				    ExecuteApplyGroup(lstate.context, *target, func_name, input, arg_count, {}, output, offset);
+			    } catch (const Exception &e) {
+				    throw InvalidInputException("%s('%s'): %s", caller, func_name, e.what());
+			    }
+			    return;
+		    }
+		    ExecuteApplyRows(input, output, group_errors, offset, target->stats,
+		                     [&](DataChunk &rows, idx_t row_offset) {
+			                     ExecuteApplyGroup(lstate.context, *target, func_name, rows, arg_count, {}, output,
+			                                       row_offset, group_errors);
+		                     });
+	    },
+	    errors);
+}
+
+static void ApplyScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
+	ExecuteApplyCall(args, state, result, ApplyErrorMode::THROW);
+}
+
+// try_apply(func VARCHAR, ...args ANY) -> ANY: NULL for rows that fail
+static void TryApplyScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
+	ExecuteApplyCall(args, state, result, ApplyErrorMode::RETURN_NULL);
+}
+
+// apply_result(func VARCHAR, ...args ANY) -> STRUCT(value ANY, error VARCHAR)
+static unique_ptr<FunctionData> BindApplyResult(ClientContext &context, ScalarFunction &bound_function,
+                                                vector<unique_ptr<Expression>> &arguments) {
+	auto bind_data = BindApply(context, bound_function, arguments);
+	child_list_t<LogicalType> children;
+	children.emplace_back("value", bound_function.return_type);
+	children.emplace_back("error", LogicalType::VARCHAR);
+	bound_function.return_type = LogicalType::STRUCT(std::move(children));
+	return bind_data;
+}
+
+static void ApplyResultScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto &entries = StructVector::GetEntries(result);
+	ExecuteApplyCall(args, state, *entries[0], ApplyErrorMode::CAPTURE, entries[1].get());
+}
+
+//===--------------------------------------------------------------------===//
+// Named dispatchers
+//===--------------------------------------------------------------------===//
+//
+// func_apply_create_dispatcher('normalize', ['lower', 'trim']) registers normalize(name, ...)
+// as a scalar function in the system catalog. A call binds like apply() with the candidate
+// list stored in the function, so it is pre-bound when the query is bound and never touches
+// the catalog while running. Dispatchers are visible to all connections and listed in
+// duckdb_functions(); they are not persisted. func_apply_drop_dispatcher() removes one.
+//
+// Both functions modify the catalog, so they are VOLATILE: the optimizer never folds them
+// into constants, as it would when planning an EXPLAIN or a func_apply_explain() query.
+
+struct ApplyDispatcherInfo : public ScalarFunctionInfo {
+	ApplyDispatcherInfo(string name_p, Value candidates_p, bool unknown_is_null_p)
+	    : name(std::move(name_p)), candidates(std::move(candidates_p)), unknown_is_null(unknown_is_null_p) {
+	}
+
+	string name;
+	Value candidates;
+	bool unknown_is_null;
+};
+
+static unique_ptr<FunctionData> BindApplyDispatcher(ClientContext &context, ScalarFunction &bound_function,
+                                                    vector<unique_ptr<Expression>> &arguments) {
+	auto &info = bound_function.function_info->Cast<ApplyDispatcherInfo>();
+	auto returns = TakeReturnsArgument(context, info.name, arguments);
+	auto result = BindApplyCandidateCall(context, info.name, bound_function, arguments, info.candidates, nullptr,
+	                                     returns);
+	result->Cast<ApplyBindData>().candidates->unknown_is_null = info.unknown_is_null;
+	return result;
+}
+
+// Whether a catalog entry is a dispatcher created by func_apply_create_dispatcher()
+static bool IsApplyDispatcher(CatalogEntry &entry) {
+	auto &functions = entry.Cast<ScalarFunctionCatalogEntry>().functions.functions;
+	return !functions.empty() && functions[0].bind == BindApplyDispatcher;
+}
+
+// func_apply_create_dispatcher(name VARCHAR, candidates VARCHAR[] [, on_unknown VARCHAR]) -> VARCHAR
+static void CreateDispatcherScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &context = state.GetContext();
+	idx_t count = args.size();
+
+	// Dispatchers are shared by all connections, so a locked session may not change them
+	if (GetSecurityConfig(context).locked) {
+		throw InvalidInputException("func_apply security settings are locked");
+	}
+
+	for (idx_t i = 0; i < count; i++) {
+		auto name_val = args.data[0].GetValue(i);
+		auto candidates = args.data[1].GetValue(i);
+		if (name_val.IsNull()) {
+			throw InvalidInputException("func_apply_create_dispatcher: name must not be NULL");
+		}
+		auto name = StringValue::Get(name_val);
+		if (!IsValidIdentifier(name)) {
+			throw InvalidInputException("func_apply_create_dispatcher: invalid function name '%s'", name);
+		}
+		bool unknown_is_null = false;
+		if (args.ColumnCount() > 2) {
+			auto policy = args.data[2].GetValue(i).ToString();
+			if (StringUtil::CIEquals(policy, "null")) {
+				unknown_is_null = true;
+			} else if (!StringUtil::CIEquals(policy, "error")) {
+				throw InvalidInputException(
+				    "func_apply_create_dispatcher: on_unknown must be 'error' or 'null', got '%s'", policy);
+			}
+		}
+
+		// Candidates must exist now; they are bound against argument types at each call
+		if (candidates.IsNull() || ListValue::GetChildren(candidates).empty()) {
+			throw InvalidInputException("func_apply_create_dispatcher: candidates must be a non-empty list");
+		}
+		for (auto &candidate : ListValue::GetChildren(candidates)) {
+			auto candidate_name = candidate.IsNull() ? string() : StringValue::Get(candidate);
+			if (!IsValidIdentifier(candidate_name) ||
+			    GetCallableFunctionType(context, candidate_name) == CatalogType::INVALID) {
+				throw InvalidInputException(
+				    "func_apply_create_dispatcher: '%s' is not a scalar function or macro", candidate_name);
+			}
+			// As in apply(), validator mode checks each call with its arguments instead
+			if (GetSecurityConfig(context).mode != "validator" && !ValidateFunctionCall(context, candidate_name, {})) {
+				throw InvalidInputException(
+				    "func_apply_create_dispatcher: function '%s' is blocked by security policy", candidate_name);
+			}
+		}
+
+		// Only an existing dispatcher may be replaced, never a built-in or user function
+		auto existing = GetFunctionEntryOfType(context, name, CatalogType::SCALAR_FUNCTION_ENTRY);
+		if (existing) {
+			if (!IsApplyDispatcher(*existing)) {
+				throw InvalidInputException("func_apply_create_dispatcher: function '%s' already exists", name);
+			}
+		} else if (CheckFunctionExists(context, name)) {
+			throw InvalidInputException("func_apply_create_dispatcher: function '%s' already exists", name);
+		}
+
+		ScalarFunction dispatcher(name, {LogicalType::VARCHAR}, LogicalType::ANY, ApplyScalarFun, BindApplyDispatcher);
+		dispatcher.varargs = LogicalType::ANY;
+		dispatcher.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+		dispatcher.init_local_state = ApplyInitLocalState;
+		dispatcher.function_info = make_shared_ptr<ApplyDispatcherInfo>(name, candidates, unknown_is_null);
+
+		CreateScalarFunctionInfo info(std::move(dispatcher));
+		info.on_conflict = OnCreateConflict::REPLACE_ON_CONFLICT;
+		FunctionDescription description;
+		description.description = "Dispatches by name to one of: " + candidates.ToString();
+		info.descriptions.push_back(std::move(description));
+		Catalog::GetSystemCatalog(context).CreateFunction(context, info);
+
+		result.SetValue(i, Value("Dispatcher created: " + name));
+	}
+}
+
+// func_apply_drop_dispatcher(name VARCHAR) -> VARCHAR
+static void DropDispatcherScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &context = state.GetContext();
+	idx_t count = args.size();
+
+	if (GetSecurityConfig(context).locked) {
+		throw InvalidInputException("func_apply security settings are locked");
+	}
+
+	for (idx_t i = 0; i < count; i++) {
+		auto name_val = args.data[0].GetValue(i);
+		if (name_val.IsNull()) {
+			throw InvalidInputException("func_apply_drop_dispatcher: name must not be NULL");
+		}
+		auto name = StringValue::Get(name_val);
+		// Only dispatchers may be dropped, never a built-in or user function
+		auto existing = GetFunctionEntryOfType(context, name, CatalogType::SCALAR_FUNCTION_ENTRY);
+		if (!existing || !IsApplyDispatcher(*existing)) {
+			throw InvalidInputException("func_apply_drop_dispatcher: '%s' is not a dispatcher", name);
+		}
+
+		DropInfo info;
+		info.type = CatalogType::SCALAR_FUNCTION_ENTRY;
+		info.schema = DEFAULT_SCHEMA;
+		info.name = existing->name;
+		Catalog::GetSystemCatalog(context).DropEntry(context, info);
+
+		result.SetValue(i, Value("Dispatcher dropped: " + name));
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// apply_with(func VARCHAR | partial, args LIST, kwargs STRUCT) -> ANY
+//===--------------------------------------------------------------------===//
+
+// Bind data for apply_with - stores which columns are args vs kwargs
+struct ApplyWithBindData : public FunctionData {
+	idx_t args_idx = 1;      // Column index for args (default: second arg)
+	idx_t kwargs_idx = 2;    // Column index for kwargs (default: third arg)
+	bool has_kwargs = false; // Whether kwargs was provided
+	// Field names of the kwargs STRUCT, fixed by its type at bind time
+	vector<string> kwarg_names;
+
+	// func is a partial() descriptor, STRUCT(func[, fixed_args][, fixed_kwargs])
+	bool has_partial = false;
+	// Descriptor fields holding fixed_args and fixed_kwargs, INVALID_INDEX if absent
+	idx_t fixed_args_field = DConstants::INVALID_INDEX;
+	idx_t fixed_kwargs_field = DConstants::INVALID_INDEX;
+	// fixed_kwargs fields that kwargs does not override, and their names
+	vector<idx_t> fixed_kwarg_fields;
+	vector<string> fixed_kwarg_names;
+	// The descriptor unpacked at bind time when it is constant. Rows then only carry args and
+	// kwargs; otherwise the fixed arguments are read from the descriptor of each row.
+	shared_ptr<ApplyPartial> partial;
+
+	unique_ptr<FunctionData> Copy() const override {
+		auto result = make_uniq<ApplyWithBindData>();
+		result->args_idx = args_idx;
+		result->kwargs_idx = kwargs_idx;
+		result->has_kwargs = has_kwargs;
+		result->kwarg_names = kwarg_names;
+		result->has_partial = has_partial;
+		result->fixed_args_field = fixed_args_field;
+		result->fixed_kwargs_field = fixed_kwargs_field;
+		result->fixed_kwarg_fields = fixed_kwarg_fields;
+		result->fixed_kwarg_names = fixed_kwarg_names;
+		result->partial = partial;
+		return std::move(result);
+	}
+	bool Equals(const FunctionData &other) const override {
+		auto &o = other.Cast<ApplyWithBindData>();
+		if (!partial != !o.partial || (partial && !(*partial == *o.partial))) {
+			return false;
+		}
+		return args_idx == o.args_idx && kwargs_idx == o.kwargs_idx && has_kwargs == o.has_kwargs &&
+		       kwarg_names == o.kwarg_names && has_partial == o.has_partial &&
+		       fixed_args_field == o.fixed_args_field && fixed_kwargs_field == o.fixed_kwargs_field &&
+		       fixed_kwarg_fields == o.fixed_kwarg_fields && fixed_kwarg_names == o.fixed_kwarg_names;
+	}
+};
+
+// Check the type of a partial() descriptor passed as func and record where its fields are.
+// A constant descriptor is unpacked here, once, instead of for every row.
+static void BindApplyWithPartial(ClientContext &context, const string &caller, Expression &descriptor,
+                                 ApplyWithBindData &bind_data) {
+	auto &type = descriptor.return_type;
+	auto &fields = StructType::GetChildTypes(type);
+	bind_data.has_partial = true;
+	if (fields[0].second.id() != LogicalTypeId::VARCHAR) {
+		throw BinderException("%s: invalid partial() descriptor %s", caller, type.ToString());
+	}
+	for (idx_t f = 1; f < fields.size(); f++) {
+		auto &field = fields[f];
+		if (StringUtil::CIEquals(field.first, "fixed_args") &&
+		    (field.second.id() == LogicalTypeId::LIST || field.second.id() == LogicalTypeId::STRUCT)) {
+			bind_data.fixed_args_field = f;
+		} else if (StringUtil::CIEquals(field.first, "fixed_kwargs") && field.second.id() == LogicalTypeId::STRUCT) {
+			bind_data.fixed_kwargs_field = f;
+		} else {
+			throw BinderException("%s: invalid partial() descriptor %s", caller, type.ToString());
+		}
+	}
+	// kwargs given with the call override fixed kwargs of the same name
+	if (bind_data.fixed_kwargs_field != DConstants::INVALID_INDEX) {
+		auto &kwarg_fields = StructType::GetChildTypes(fields[bind_data.fixed_kwargs_field].second);
+		for (idx_t f = 0; f < kwarg_fields.size(); f++) {
+			auto &name = kwarg_fields[f].first;
+			bool overridden = false;
+			for (auto &kwarg_name : bind_data.kwarg_names) {
+				overridden = overridden || StringUtil::CIEquals(kwarg_name, name);
+			}
+			if (!overridden) {
+				bind_data.fixed_kwarg_fields.push_back(f);
+				bind_data.fixed_kwarg_names.push_back(name);
+			}
+		}
+	}
+
+	if (!descriptor.IsFoldable()) {
+		if (bind_data.fixed_args_field != DConstants::INVALID_INDEX) {
+			auto &fixed_args_type = fields[bind_data.fixed_args_field].second;
+			if (fixed_args_type.id() == LogicalTypeId::LIST &&
+			    ListType::GetChildType(fixed_args_type).id() == LogicalTypeId::UNION) {
+				throw BinderException("%s: fixed_args of a non-constant partial() descriptor cannot be a LIST of UNION",
+				                      caller);
+			}
+		}
+		return;
+	}
+	auto value = ExpressionExecutor::EvaluateScalar(context, descriptor);
+	if (value.IsNull()) {
+		return;
+	}
+	auto &children = StructValue::GetChildren(value);
+	if (children[0].IsNull()) {
+		return;
+	}
+	auto partial = make_shared_ptr<ApplyPartial>();
+	partial->func_name = StringValue::Get(children[0]);
+	if (bind_data.fixed_args_field != DConstants::INVALID_INDEX) {
+		auto &fixed_args = children[bind_data.fixed_args_field];
+		if (!fixed_args.IsNull()) {
+			partial->positional = fixed_args.type().id() == LogicalTypeId::LIST ? ListValue::GetChildren(fixed_args)
+			                                                                     : StructValue::GetChildren(fixed_args);
+		}
+	}
+	if (bind_data.fixed_kwargs_field != DConstants::INVALID_INDEX) {
+		auto &fixed_kwargs = children[bind_data.fixed_kwargs_field];
+		auto &kwarg_fields = StructType::GetChildTypes(fixed_kwargs.type());
+		for (idx_t k = 0; k < bind_data.fixed_kwarg_fields.size(); k++) {
+			auto f = bind_data.fixed_kwarg_fields[k];
+			partial->names.push_back(bind_data.fixed_kwarg_names[k]);
+			partial->named.push_back(fixed_kwargs.IsNull() ? Value(kwarg_fields[f].second)
+			                                               : StructValue::GetChildren(fixed_kwargs)[f]);
+		}
+	}
+	bind_data.partial = std::move(partial);
+}
+
+static unique_ptr<FunctionData> BindApplyWith(ClientContext &context, ScalarFunction &bound_function,
+                                              vector<unique_ptr<Expression>> &arguments) {
+	// Shared by apply_with and try_apply_with
+	auto caller = bound_function.name;
+	auto bind_data = make_uniq<ApplyWithBindData>();
+	bound_function.return_type = LogicalType::VARCHAR;
+
+	if (arguments.empty()) {
+		throw InvalidInputException("%s requires at least a function name", caller);
+	}
+	auto returns = TakeReturnsArgument(context, caller, arguments);
+
+	// First argument is always the function name
+	// Remaining arguments can be positional (args, kwargs) or named (args := ..., kwargs := ...)
+	for (idx_t i = 1; i < arguments.size(); i++) {
+		auto &alias = arguments[i]->alias;
+		if (alias == "args") {
+			bind_data->args_idx = i;
+		} else if (alias == "kwargs") {
+			bind_data->kwargs_idx = i;
+			bind_data->has_kwargs = true;
+		} else if (i == 1) {
+			// Positional: first extra arg is args
+			bind_data->args_idx = i;
+		} else if (i == 2) {
+			// Positional: second extra arg is kwargs
+			bind_data->kwargs_idx = i;
+			bind_data->has_kwargs = true;
+		}
+	}
+
+	// args is a LIST (one element per argument), or a STRUCT whose fields are the arguments
+	// in order, which allows arguments of different types
+	if (bind_data->args_idx < arguments.size()) {
+		auto &args_type = arguments[bind_data->args_idx]->return_type;
+		if (args_type.id() != LogicalTypeId::LIST && args_type.id() != LogicalTypeId::STRUCT &&
+		    args_type.id() != LogicalTypeId::SQLNULL) {
+			throw BinderException("%s: args must be a LIST or STRUCT, got %s", caller, args_type.ToString());
+		}
+	}
+
+	// kwargs field names are part of the STRUCT type, so they are known here; at runtime the
+	// values are read straight from the STRUCT's child vectors
+	if (bind_data->has_kwargs && bind_data->kwargs_idx < arguments.size()) {
+		auto &kwargs_type = arguments[bind_data->kwargs_idx]->return_type;
+		if (kwargs_type.id() == LogicalTypeId::STRUCT) {
+			for (auto &child : StructType::GetChildTypes(kwargs_type)) {
+				bind_data->kwarg_names.push_back(child.first);
+			}
+		} else if (kwargs_type.id() != LogicalTypeId::SQLNULL) {
+			throw BinderException("%s: kwargs must be a STRUCT, got %s", caller, kwargs_type.ToString());
+		}
+	}
+
+	// func is a function name or a partial() descriptor
+	auto &func_type = arguments[0]->return_type;
+	if (func_type.id() == LogicalTypeId::STRUCT) {
+		if (StructType::GetChildCount(func_type) == 0 ||
+		    !StringUtil::CIEquals(StructType::GetChildName(func_type, 0), "func")) {
+			throw BinderException("%s: func must be a function name or a partial() descriptor, got %s", caller,
+			                      func_type.ToString());
+		}
+		BindApplyWithPartial(context, caller, *arguments[0], *bind_data);
+	} else if (func_type.id() != LogicalTypeId::VARCHAR && func_type.id() != LogicalTypeId::SQLNULL) {
+		arguments[0] = BoundCastExpression::AddCastToType(context, std::move(arguments[0]), LogicalType::VARCHAR);
+	}
+	bound_function.arguments[0] = arguments[0]->return_type;
+
+	if (returns.id() != LogicalTypeId::INVALID) {
+		bound_function.return_type = returns;
+	}
+
+	// Try to infer return type if function name is constant
+	Value func_name_val;
+	if (bind_data->partial) {
+		func_name_val = Value(bind_data->partial->func_name);
+	} else if (!bind_data->has_partial && arguments[0]->IsFoldable()) {
+		func_name_val = ExpressionExecutor::EvaluateScalar(context, *arguments[0]);
+	}
+	if (!func_name_val.IsNull()) {
+		string func_name = StringValue::Get(func_name_val);
+		// With constant args, map kwargs to parameter positions now so that a name the
+		// function does not have is a bind error rather than a runtime one
+		bool struct_args = bind_data->args_idx < arguments.size() &&
+		                   arguments[bind_data->args_idx]->return_type.id() == LogicalTypeId::STRUCT;
+		bool constant_args = bind_data->args_idx >= arguments.size() || struct_args ||
+		                     arguments[bind_data->args_idx]->IsFoldable();
+		auto named = bind_data->partial ? bind_data->partial->names : vector<string>();
+		named.insert(named.end(), bind_data->kwarg_names.begin(), bind_data->kwarg_names.end());
+		if (IsValidIdentifier(func_name) && !named.empty() && constant_args &&
+		    GetCallableFunctionType(context, func_name) == CatalogType::SCALAR_FUNCTION_ENTRY) {
+			idx_t positional_count = bind_data->partial ? bind_data->partial->positional.size() : 0;
+			if (struct_args) {
+				positional_count += StructType::GetChildCount(arguments[bind_data->args_idx]->return_type);
+			} else if (bind_data->args_idx < arguments.size()) {
+				auto args_val = ExpressionExecutor::EvaluateScalar(context, *arguments[bind_data->args_idx]);
+				if (!args_val.IsNull() && args_val.type().id() == LogicalTypeId::LIST) {
+					positional_count += ListValue::GetChildren(args_val).size();
+				}
+			}
+			try {
+				ResolveApplyArguments(context, func_name, positional_count, named);
+			} catch (const Exception &e) {
+				throw BinderException("%s('%s'): %s", caller, func_name, e.what());
+			}
+		}
+		if (IsValidIdentifier(func_name) && returns.id() == LogicalTypeId::INVALID) {
+			auto func_type = GetCallableFunctionType(context, func_name);
+			if (func_type == CatalogType::SCALAR_FUNCTION_ENTRY) {
+				auto &catalog = Catalog::GetSystemCatalog(context);
+				auto func_entry = catalog.GetEntry<ScalarFunctionCatalogEntry>(context, DEFAULT_SCHEMA, func_name,
+				                                                               OnEntryNotFound::RETURN_NULL);
+				if (func_entry && !func_entry->functions.functions.empty()) {
+					auto &first_func = func_entry->functions.functions[0];
+					if (first_func.return_type.id() != LogicalTypeId::ANY) {
+						bound_function.return_type = first_func.return_type;
+					}
+				}
+			}
+		}
+	}
+
+	return std::move(bind_data);
+}
+
+// Type of positional argument k taken from an args value: a LIST (of UNION, with the active
+// member of each argument in `tags`) or a STRUCT
+static LogicalType GetApplyWithArgumentType(const LogicalType &args_type, idx_t k, const vector<idx_t> &tags) {
+	if (args_type.id() == LogicalTypeId::STRUCT) {
+		return StructType::GetChildType(args_type, k);
+	}
+	if (tags.empty()) {
+		return ListType::GetChildType(args_type);
+	}
+	if (tags[k] == APPLY_NULL_TAG) {
+		return LogicalType::SQLNULL;
+	}
+	return UnionType::GetMemberType(ListType::GetChildType(args_type), UnsafeNumericCast<union_tag_t>(tags[k]));
+}
+
+// Slice positional argument k of a group's rows out of an args vector. Nothing is copied:
+// with a LIST, it is a dictionary slice of the list's child vector at (offset + k) of each
+// row (for a LIST of UNION, of the group's active member); STRUCT fields are slices of the
+// STRUCT's child vectors.
+static void SliceApplyWithArgument(Vector &args_vector, idx_t count, const ApplyRowGroups::Group &group, idx_t k,
+                                   const vector<idx_t> &tags, Vector &column) {
+	if (args_vector.GetType().id() == LogicalTypeId::STRUCT) {
+		args_vector.Flatten(count);
+		column.Slice(*StructVector::GetEntries(args_vector)[k], group.sel, group.count);
+		return;
+	}
+	if (!tags.empty() && tags[k] == APPLY_NULL_TAG) {
+		column.Reference(Value());
+		return;
+	}
+	UnifiedVectorFormat list_data;
+	args_vector.ToUnifiedFormat(count, list_data);
+	auto list_entries = UnifiedVectorFormat::GetData<list_entry_t>(list_data);
+	SelectionVector child_sel(group.count);
+	for (idx_t i = 0; i < group.count; i++) {
+		auto list_idx = list_data.sel->get_index(group.sel.get_index(i));
+		child_sel.set_index(i, list_entries[list_idx].offset + k);
+	}
+	auto &child = ListVector::GetEntry(args_vector);
+	auto &source = tags.empty() ? child : UnionVector::GetMember(child, UnsafeNumericCast<union_tag_t>(tags[k]));
+	column.Slice(source, child_sel, group.count);
+}
+
+// Build the input of one apply_with group: positional arguments, then one column per named
+// argument. A partial() descriptor that was not constant at bind time contributes its fixed
+// args ahead of args and its fixed kwargs ahead of kwargs, all sliced like args.
+static void BuildApplyWithInput(DataChunk &args, const ApplyWithBindData &bind_data, ApplyRowGroups::Group &group,
+                                DataChunk &input) {
+	const vector<idx_t> no_tags;
+	optional_ptr<Vector> fixed_args_vector;
+	optional_ptr<Vector> fixed_kwargs_vector;
+	if (bind_data.has_partial && !bind_data.partial) {
+		auto &fields = StructVector::GetEntries(args.data[0]);
+		if (group.fixed_count > 0) {
+			fixed_args_vector = fields[bind_data.fixed_args_field].get();
+		}
+		if (!bind_data.fixed_kwarg_fields.empty()) {
+			fixed_kwargs_vector = fields[bind_data.fixed_kwargs_field].get();
+			fixed_kwargs_vector->Flatten(args.size());
+		}
+	}
+	optional_ptr<Vector> args_vector;
+	if (group.arg_count > 0) {
+		args_vector = &args.data[bind_data.args_idx];
+	}
+	optional_ptr<Vector> kwargs_vector;
+	if (!bind_data.kwarg_names.empty()) {
+		kwargs_vector = &args.data[bind_data.kwargs_idx];
+		kwargs_vector->Flatten(args.size());
+	}
+
+	vector<LogicalType> types;
+	for (idx_t k = 0; k < group.fixed_count; k++) {
+		types.push_back(GetApplyWithArgumentType(fixed_args_vector->GetType(), k, no_tags));
+	}
+	for (idx_t k = 0; k < group.arg_count; k++) {
+		types.push_back(GetApplyWithArgumentType(args_vector->GetType(), k, group.tags));
+	}
+	if (fixed_kwargs_vector) {
+		for (auto f : bind_data.fixed_kwarg_fields) {
+			types.push_back(StructType::GetChildType(fixed_kwargs_vector->GetType(), f));
+		}
+	}
+	if (kwargs_vector) {
+		for (auto &child : StructType::GetChildTypes(kwargs_vector->GetType())) {
+			types.push_back(child.second);
+		}
+	}
+
+	input.InitializeEmpty(types);
+	idx_t column = 0;
+	for (idx_t k = 0; k < group.fixed_count; k++) {
+		SliceApplyWithArgument(*fixed_args_vector, args.size(), group, k, no_tags, input.data[column++]);
+	}
+	for (idx_t k = 0; k < group.arg_count; k++) {
+		SliceApplyWithArgument(*args_vector, args.size(), group, k, group.tags, input.data[column++]);
+	}
+	if (fixed_kwargs_vector) {
+		auto &entries = StructVector::GetEntries(*fixed_kwargs_vector);
+		for (auto f : bind_data.fixed_kwarg_fields) {
+			input.data[column++].Slice(*entries[f], group.sel, group.count);
+		}
+	}
+	if (kwargs_vector) {
+		for (auto &entry : StructVector::GetEntries(*kwargs_vector)) {
+			input.data[column++].Slice(*entry, group.sel, group.count);
+		}
+	}
+	input.SetCardinality(group.count);
+}
+
+static void ExecuteApplyWithCall(DataChunk &args, ExpressionState &state, Vector &result, ApplyErrorMode mode) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &bind_data = func_expr.bind_info->Cast<ApplyWithBindData>();
+	auto &caller = func_expr.function.name;
+	auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<ApplyLocalState>();
+	idx_t count = args.size();
+	auto &partial = bind_data.partial;
+
+	// The function name comes from func or, for a partial() descriptor, from its func field.
+	// A descriptor that was constant at bind time is not looked at again.
+	optional_ptr<Vector> descriptor;
+	UnifiedVectorFormat name_data;
+	UnifiedVectorFormat fixed_args_data;
+	LogicalType fixed_args_type = LogicalType::SQLNULL;
+	if (!partial) {
+		optional_ptr<Vector> name_vector = &args.data[0];
+		if (bind_data.has_partial) {
+			descriptor = &args.data[0];
+			descriptor->Flatten(count);
+			auto &fields = StructVector::GetEntries(*descriptor);
+			name_vector = fields[0].get();
+			if (bind_data.fixed_args_field != DConstants::INVALID_INDEX) {
+				fixed_args_type = fields[bind_data.fixed_args_field]->GetType();
+				fields[bind_data.fixed_args_field]->ToUnifiedFormat(count, fixed_args_data);
+			}
+		}
+		name_vector->ToUnifiedFormat(count, name_data);
+	}
+	auto names = partial ? nullptr : UnifiedVectorFormat::GetData<string_t>(name_data);
+
+	// Only the length of each args list (and for a LIST of UNION, the active member of each
+	// element) is needed to group the rows
+	auto args_type = bind_data.args_idx < args.ColumnCount() ? args.data[bind_data.args_idx].GetType()
+	                                                         : LogicalType::SQLNULL;
+	bool has_list_args = args_type.id() == LogicalTypeId::LIST;
+	bool has_union_args = has_list_args && ListType::GetChildType(args_type).id() == LogicalTypeId::UNION;
+	UnifiedVectorFormat args_data;
+	if (args_type.id() != LogicalTypeId::SQLNULL) {
+		args.data[bind_data.args_idx].ToUnifiedFormat(count, args_data);
+	}
+	auto list_entries = has_list_args ? UnifiedVectorFormat::GetData<list_entry_t>(args_data) : nullptr;
+	optional_ptr<Vector> union_child;
+	if (has_union_args) {
+		auto &args_vector = args.data[bind_data.args_idx];
+		union_child = &ListVector::GetEntry(args_vector);
+		union_child->Flatten(ListVector::GetListSize(args_vector));
+	}
+
+	// Group rows by function name and number of positional arguments
+	ApplyRowGroups groups(count);
+	vector<idx_t> tags;
+	for (idx_t i = 0; i < count; i++) {
+		if (descriptor && !FlatVector::Validity(*descriptor).RowIsValid(i)) {
+			groups.AddNull(i);
+			continue;
+		}
+		auto name_idx = partial ? 0 : name_data.sel->get_index(i);
+		if (!partial && !name_data.validity.RowIsValid(name_idx)) {
+			groups.AddNull(i);
+			continue;
+		}
+		idx_t fixed_count = 0;
+		auto fixed_idx = fixed_args_type.id() == LogicalTypeId::SQLNULL ? 0 : fixed_args_data.sel->get_index(i);
+		if (fixed_args_type.id() == LogicalTypeId::STRUCT && fixed_args_data.validity.RowIsValid(fixed_idx)) {
+			fixed_count = StructType::GetChildCount(fixed_args_type);
+		} else if (fixed_args_type.id() == LogicalTypeId::LIST && fixed_args_data.validity.RowIsValid(fixed_idx)) {
+			fixed_count = UnifiedVectorFormat::GetData<list_entry_t>(fixed_args_data)[fixed_idx].length;
+		}
+		idx_t arg_count = 0;
+		tags.clear();
+		auto args_idx = args_type.id() == LogicalTypeId::SQLNULL ? 0 : args_data.sel->get_index(i);
+		if (args_type.id() == LogicalTypeId::STRUCT && args_data.validity.RowIsValid(args_idx)) {
+			arg_count = StructType::GetChildCount(args_type);
+		} else if (has_list_args && args_data.validity.RowIsValid(args_idx)) {
+			auto &entry = list_entries[args_idx];
+			arg_count = entry.length;
+			if (has_union_args) {
+				auto &validity = FlatVector::Validity(*union_child);
+				for (idx_t k = 0; k < entry.length; k++) {
+					auto element = entry.offset + k;
+					tags.push_back(validity.RowIsValid(element) ? UnionVector::GetTag(*union_child, element)
+					                                            : APPLY_NULL_TAG);
+				}
+			}
+		}
+		groups.Add(partial ? partial->func_name : names[name_idx].GetString(), arg_count, i, tags, fixed_count);
+	}
+
+	// Fixed kwargs of a per-row descriptor are input columns ahead of kwargs
+	vector<string> named;
+	if (!partial) {
+		named = bind_data.fixed_kwarg_names;
+	}
+	named.insert(named.end(), bind_data.kwarg_names.begin(), bind_data.kwarg_names.end());
+	groups.Execute(result, [&](ApplyRowGroups::Group &group, Vector &output, Vector &errors, idx_t offset) {
+		auto &func_name = group.func_name;
+		auto positional_count = group.fixed_count + group.arg_count;
+		DataChunk input;
+		BuildApplyWithInput(args, bind_data, group, input);
+		if (mode == ApplyErrorMode::THROW) {
+			if (!IsValidIdentifier(func_name)) {
+				throw InvalidInputException("%s: invalid function name '%s'", caller, func_name);
+			}
+			try {
+				auto &target = lstate.GetTarget(func_name, input.GetTypes(), positional_count, named, partial.get());
+				ExecuteApplyGroup(lstate.context, target, func_name, input, positional_count, named, output, offset);
+			} catch (const Exception &e) {
+				throw InvalidInputException("%s('%s'): %s", caller, func_name, e.what());
+			}
+			return;
+		}
+
+		// A name that cannot be resolved fails every row of its group
+		optional_ptr<ApplyBoundTarget> target;
+		try {
+			if (!IsValidIdentifier(func_name)) {
+				throw InvalidInputException("invalid function name '%s'", func_name);
+			}
+			target = lstate.GetTarget(func_name, input.GetTypes(), positional_count, named, partial.get());
+		} catch (std::exception &ex) {
+			ErrorData error(ex);
+			if (!IsApplyRowError(error)) {
+				throw;
+			}
+			SetApplyRowsFailed(output, errors, offset, group.count, error.RawMessage());
+			return;
+		}
+		ExecuteApplyRows(input, output, errors, offset, target->stats, [&](DataChunk &rows, idx_t row_offset) {
+			ExecuteApplyGroup(lstate.context, *target, func_name, rows, positional_count, named, output, row_offset,
+			                  errors);
+		});
+	});
+}
+
+static void ApplyWithScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
+	ExecuteApplyWithCall(args, state, result, ApplyErrorMode::THROW);
+}
+
+// try_apply_with(func VARCHAR, args, kwargs) -> ANY: NULL for rows that fail
+static void TryApplyWithScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
+	ExecuteApplyWithCall(args, state, result, ApplyErrorMode::RETURN_NULL);
+}
+
+//===--------------------------------------------------------------------===//
+// partial(func VARCHAR, fixed_args LIST | STRUCT, fixed_kwargs STRUCT) -> STRUCT
+//===--------------------------------------------------------------------===//
+//
+// Builds a function descriptor, STRUCT(func, fixed_args, fixed_kwargs), that apply_with
+// accepts in place of a function name:
+//
+//   SELECT apply_with(partial('concat', ['https://']), args := [host]) FROM sites;
+//
+// Descriptors are plain values and can be stored in tables. See BindApplyWithPartial for
+// how apply_with binds a constant one.
+
+static unique_ptr<FunctionData> BindPartial(ClientContext &context, ScalarFunction &bound_function,
+                                            vector<unique_ptr<Expression>> &arguments) {
+	if (arguments.size() > 3) {
+		throw BinderException("partial: expected partial(func, fixed_args, fixed_kwargs)");
+	}
+	// Omitted or NULL fixed_args and fixed_kwargs are left out of the descriptor
+	child_list_t<LogicalType> fields;
+	fields.emplace_back("func", LogicalType::VARCHAR);
+	if (arguments.size() > 1) {
+		auto &fixed_args_type = arguments[1]->return_type;
+		if (fixed_args_type.id() == LogicalTypeId::LIST || fixed_args_type.id() == LogicalTypeId::STRUCT) {
+			fields.emplace_back("fixed_args", fixed_args_type);
+		} else if (fixed_args_type.id() != LogicalTypeId::SQLNULL) {
+			throw BinderException("partial: fixed_args must be a LIST or STRUCT, got %s", fixed_args_type.ToString());
+		}
+	}
+	if (arguments.size() > 2) {
+		auto &fixed_kwargs_type = arguments[2]->return_type;
+		if (fixed_kwargs_type.id() == LogicalTypeId::STRUCT) {
+			fields.emplace_back("fixed_kwargs", fixed_kwargs_type);
+		} else if (fixed_kwargs_type.id() != LogicalTypeId::SQLNULL) {
+			throw BinderException("partial: fixed_kwargs must be a STRUCT, got %s", fixed_kwargs_type.ToString());
+		}
+	}
+	bound_function.return_type = LogicalType::STRUCT(std::move(fields));
+	return nullptr;
+}
+
+// The descriptor's fields reference the argument vectors, like struct_pack
+static void PartialScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &fields = StructVector::GetEntries(result);
+	bool all_constant = true;
+	idx_t field = 0;
+	for (idx_t c = 0; c < args.ColumnCount(); c++) {
+		if (args.data[c].GetType().id() == LogicalTypeId::SQLNULL) {
+			continue;
+		}
+		if (args.data[c].GetVectorType() != VectorType::CONSTANT_VECTOR) {
+			all_constant = false;
+		}
+		fields[field++]->Reference(args.data[c]);
+	}
+	result.SetVectorType(all_constant ? VectorType::CONSTANT_VECTOR : VectorType::FLAT_VECTOR);
+}
+
+//===--------------------------------------------------------------------===//
+// apply_chain(funcs VARCHAR[], ...args ANY) -> ANY
+//===--------------------------------------------------------------------===//
+//
+// Calls each function of a list on the result of the previous one, the first on args:
+//
+//   SELECT apply_chain(['trim', 'lower', 'md5'], email) FROM users;
+//
+// is md5(lower(trim(email))). The chain is bound as one nested expression, so values pass
+// from one call to the next as vectors. A constant list is bound at bind time; lists that
+// vary per row are grouped by chain, and each distinct chain is bound once per thread.
+
+struct ApplyChain {
+	vector<string> names;
+	// The fused target, in a vector for ApplyLocalState::GetPrebound
+	vector<unique_ptr<ApplyBoundTarget>> targets;
+};
+
+struct ApplyChainBindData : public FunctionData {
+	explicit ApplyChainBindData(shared_ptr<ApplyChain> chain_p) : chain(std::move(chain_p)) {
+	}
+
+	// Bound at bind time when the list of names is constant, NULL otherwise
+	shared_ptr<ApplyChain> chain;
+
+	unique_ptr<FunctionData> Copy() const override {
+		return make_uniq<ApplyChainBindData>(chain);
+	}
+	bool Equals(const FunctionData &other) const override {
+		auto &o = other.Cast<ApplyChainBindData>();
+		if (!chain || !o.chain) {
+			return !chain && !o.chain;
+		}
+		return chain->names == o.chain->names;
+	}
+};
+
+static unique_ptr<FunctionData> BindApplyChain(ClientContext &context, ScalarFunction &bound_function,
+                                               vector<unique_ptr<Expression>> &arguments) {
+	auto returns = TakeReturnsArgument(context, "apply_chain", arguments);
+	bound_function.return_type = returns.id() != LogicalTypeId::INVALID ? returns : LogicalType::VARCHAR;
+	if (!arguments[0]->IsFoldable()) {
+		return make_uniq<ApplyChainBindData>(nullptr);
+	}
+	auto names_val = ExpressionExecutor::EvaluateScalar(context, *arguments[0]);
+	if (names_val.IsNull()) {
+		return make_uniq<ApplyChainBindData>(nullptr);
+	}
+	auto chain = make_shared_ptr<ApplyChain>();
+	for (auto &name_val : ListValue::GetChildren(names_val)) {
+		if (name_val.IsNull()) {
+			throw BinderException("apply_chain: function names must not be NULL");
+		}
+		auto &func_name = StringValue::Get(name_val);
+		if (!IsValidIdentifier(func_name)) {
+			throw BinderException("apply_chain: invalid function name '%s'", func_name);
+		}
+		chain->names.push_back(func_name);
+	}
+	if (chain->names.empty()) {
+		throw BinderException("apply_chain: the list of functions must not be empty");
+	}
+	vector<LogicalType> input_types;
+	for (idx_t i = 1; i < arguments.size(); i++) {
+		input_types.push_back(arguments[i]->return_type);
+	}
+	unique_ptr<ApplyBoundTarget> target;
+	try {
+		target = MakeApplyChainTarget(context, chain->names, input_types);
+	} catch (const Exception &e) {
+		throw BinderException("apply_chain('%s'): %s", StringUtil::Join(chain->names, "', '"), e.what());
+	}
+	if (target->expr && returns.id() == LogicalTypeId::INVALID) {
+		bound_function.return_type = target->expr->return_type;
+	}
+	chain->targets.push_back(std::move(target));
+	return make_uniq<ApplyChainBindData>(std::move(chain));
+}
+
+// Run a chain over one group of rows. Outside validator mode this is one fused target; in
+// validator mode every call runs on its own, and is validated with its own arguments.
+static void ExecuteApplyChainGroup(ApplyLocalState &lstate, const vector<string> &names,
+                                   optional_ptr<ApplyBoundTarget> fused, DataChunk &input, Vector &output,
+                                   idx_t offset) {
+	if (GetSecurityConfig(lstate.context).mode != "validator") {
+		auto &target = fused ? *fused : lstate.GetChainTarget(names, input.GetTypes());
+		ExecuteApplyTarget(target, input, output, offset);
+		return;
+	}
+	auto count = input.size();
+	DataChunk stage_input;
+	stage_input.InitializeEmpty(input.GetTypes());
+	stage_input.Reference(input);
+	for (idx_t k = 0; k < names.size(); k++) {
+		auto column_count = stage_input.ColumnCount();
+		auto &target = lstate.GetTarget(names[k], stage_input.GetTypes(), column_count, {});
+		if (k + 1 == names.size()) {
+			ExecuteApplyGroup(lstate.context, target, names[k], stage_input, column_count, {}, output, offset);
+			return;
+		}
+		if (target.by_value) {
+			// As in the fused chain, every argument is passed as a reference
+			throw InvalidInputException("Function '%s' requires constant arguments, which apply_chain does not pass",
+			                            names[k]);
+		}
+		Vector stage_result(target.expr->return_type, count);
+		ExecuteApplyGroup(lstate.context, target, names[k], stage_input, column_count, {}, stage_result, 0);
+		stage_input.Destroy();
+		stage_input.InitializeEmpty({stage_result.GetType()});
+		stage_input.data[0].Reference(stage_result);
+		stage_input.SetCardinality(count);
+	}
+}
+
+static void ApplyChainScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &chain = func_expr.bind_info->Cast<ApplyChainBindData>().chain;
+	auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<ApplyLocalState>();
+	idx_t count = args.size();
+	idx_t arg_count = args.ColumnCount() - 1;
+
+	DataChunk input;
+	vector<LogicalType> input_types;
+	for (idx_t c = 1; c < args.ColumnCount(); c++) {
+		input_types.push_back(args.data[c].GetType());
+	}
+
+	// A constant chain runs over the whole chunk as a single group
+	if (chain) {
+		input.InitializeEmpty(input_types);
+		for (idx_t c = 0; c < arg_count; c++) {
+			input.data[c].Reference(args.data[c + 1]);
+		}
+		input.SetCardinality(count);
+		try {
+			ExecuteApplyChainGroup(lstate, chain->names, lstate.GetPrebound(chain->targets, 0), input, result, 0);
+		} catch (const Exception &e) {
+			throw InvalidInputException("apply_chain('%s'): %s", StringUtil::Join(chain->names, "', '"), e.what());
+		}
+		return;
+	}
+
+	// Otherwise rows are grouped by their list of names. Group keys prefix each name with its
+	// length, so that no two lists share a key.
+	UnifiedVectorFormat list_data;
+	args.data[0].ToUnifiedFormat(count, list_data);
+	auto list_entries = UnifiedVectorFormat::GetData<list_entry_t>(list_data);
+	auto &child = ListVector::GetEntry(args.data[0]);
+	UnifiedVectorFormat child_data;
+	child.ToUnifiedFormat(ListVector::GetListSize(args.data[0]), child_data);
+	auto child_names = UnifiedVectorFormat::GetData<string_t>(child_data);
+
+	ApplyRowGroups groups(count);
+	unordered_map<string, vector<string>> chains;
+	for (idx_t i = 0; i < count; i++) {
+		auto list_idx = list_data.sel->get_index(i);
+		if (!list_data.validity.RowIsValid(list_idx)) {
+			groups.AddNull(i);
+			continue;
+		}
+		auto &entry = list_entries[list_idx];
+		if (entry.length == 0) {
+			throw InvalidInputException("apply_chain: the list of functions must not be empty");
+		}
+		string key;
+		bool has_null = false;
+		for (idx_t k = 0; k < entry.length && !has_null; k++) {
+			auto name_idx = child_data.sel->get_index(entry.offset + k);
+			has_null = !child_data.validity.RowIsValid(name_idx);
+			if (!has_null) {
+				auto &name = child_names[name_idx];
+				key += to_string(name.GetSize()) + ":" + name.GetString();
+			}
+		}
+		if (has_null) {
+			groups.AddNull(i);
+			continue;
+		}
+		if (chains.find(key) == chains.end()) {
+			auto &names = chains[key];
+			for (idx_t k = 0; k < entry.length; k++) {
+				auto name = child_names[child_data.sel->get_index(entry.offset + k)].GetString();
+				if (!IsValidIdentifier(name)) {
+					throw InvalidInputException("apply_chain: invalid function name '%s'", name);
+				}
+				names.push_back(std::move(name));
+			}
+		}
+		groups.Add(key, arg_count, i);
+	}
+
+	groups.Execute(result, [&](ApplyRowGroups::Group &group, Vector &output, Vector &errors, idx_t offset) {
+		auto &names = chains[group.func_name];
+		input.Destroy();
+		input.InitializeEmpty(input_types);
+		for (idx_t c = 0; c < arg_count; c++) {
+			input.data[c].Slice(args.data[c + 1], group.sel, group.count);
+		}
+		input.SetCardinality(group.count);
+		try {
+			ExecuteApplyChainGroup(lstate, names, nullptr, input, output, offset);
+		} catch (const Exception &e) {
+			throw InvalidInputException("apply_chain('%s'): %s", StringUtil::Join(names, "', '"), e.what());
+		}
+	});
+}
+
+//===--------------------------------------------------------------------===//
+// apply_expr(expr VARCHAR, ...args ANY) -> ANY
+//===--------------------------------------------------------------------===//
+//
+// Evaluates an SQL expression given as text, with $1, $2, ... standing for the arguments:
+//
+//   SELECT apply_expr(rule, name, suffix) FROM rules;    -- rule = 'upper(trim($1)) || $2'
+//
+// Each distinct text is parsed and bound once for the argument types and then evaluated
+// vectorized like any other expression. A constant text is bound at bind time; texts that
+// vary per row are grouped, and each one is bound once per thread. Subqueries are rejected,
+// and every function the expression calls goes through the security policy.
+
+struct ApplyExpr {
+	string text;
+	// The bound expression, in a vector for ApplyLocalState::GetPrebound
+	vector<unique_ptr<ApplyBoundTarget>> targets;
+};
+
+struct ApplyExprBindData : public FunctionData {
+	explicit ApplyExprBindData(shared_ptr<ApplyExpr> expr_p) : expr(std::move(expr_p)) {
+	}
+
+	// Bound at bind time when the text is constant, NULL otherwise
+	shared_ptr<ApplyExpr> expr;
+
+	unique_ptr<FunctionData> Copy() const override {
+		return make_uniq<ApplyExprBindData>(expr);
+	}
+	bool Equals(const FunctionData &other) const override {
+		auto &o = other.Cast<ApplyExprBindData>();
+		if (!expr || !o.expr) {
+			return !expr && !o.expr;
+		}
+		return expr->text == o.expr->text;
+	}
+};
+
+static unique_ptr<FunctionData> BindApplyExpr(ClientContext &context, ScalarFunction &bound_function,
+                                              vector<unique_ptr<Expression>> &arguments) {
+	auto returns = TakeReturnsArgument(context, "apply_expr", arguments);
+	bound_function.return_type = returns.id() != LogicalTypeId::INVALID ? returns : LogicalType::VARCHAR;
+	if (!arguments[0]->IsFoldable()) {
+		return make_uniq<ApplyExprBindData>(nullptr);
+	}
+	auto text_val = ExpressionExecutor::EvaluateScalar(context, *arguments[0]);
+	if (text_val.IsNull()) {
+		return make_uniq<ApplyExprBindData>(nullptr);
+	}
+	auto expr = make_shared_ptr<ApplyExpr>();
+	expr->text = StringValue::Get(text_val);
+	vector<LogicalType> input_types;
+	for (idx_t i = 1; i < arguments.size(); i++) {
+		input_types.push_back(arguments[i]->return_type);
+	}
+	unique_ptr<ApplyBoundTarget> target;
+	try {
+		target = MakeApplyExprTarget(context, expr->text, input_types);
+	} catch (const Exception &e) {
+		throw BinderException("apply_expr('%s'): %s", expr->text, e.what());
+	}
+	if (target->expr && returns.id() == LogicalTypeId::INVALID) {
+		bound_function.return_type = target->expr->return_type;
+	}
+	expr->targets.push_back(std::move(target));
+	return make_uniq<ApplyExprBindData>(std::move(expr));
+}
+
+static void ApplyExprScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &constant_expr = func_expr.bind_info->Cast<ApplyExprBindData>().expr;
+	auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<ApplyLocalState>();
+	idx_t count = args.size();
+	idx_t arg_count = args.ColumnCount() - 1;
+
+	DataChunk input;
+	vector<LogicalType> input_types;
+	for (idx_t c = 1; c < args.ColumnCount(); c++) {
+		input_types.push_back(args.data[c].GetType());
+	}
+
+	// A constant expression runs over the whole chunk
+	if (constant_expr) {
+		input.InitializeEmpty(input_types);
+		for (idx_t c = 0; c < arg_count; c++) {
+			input.data[c].Reference(args.data[c + 1]);
+		}
+		input.SetCardinality(count);
+		try {
+			ExecuteApplyTarget(lstate.GetPrebound(constant_expr->targets, 0), input, result, 0);
+		} catch (const Exception &e) {
+			throw InvalidInputException("apply_expr('%s'): %s", constant_expr->text, e.what());
+		}
+		return;
+	}
+
+	// Otherwise rows are grouped by expression text
+	UnifiedVectorFormat text_data;
+	args.data[0].ToUnifiedFormat(count, text_data);
+	auto texts = UnifiedVectorFormat::GetData<string_t>(text_data);
+	ApplyRowGroups groups(count);
+	for (idx_t i = 0; i < count; i++) {
+		auto text_idx = text_data.sel->get_index(i);
+		if (!text_data.validity.RowIsValid(text_idx)) {
+			groups.AddNull(i);
+			continue;
+		}
+		groups.Add(texts[text_idx].GetString(), arg_count, i);
+	}
+
+	groups.Execute(result, [&](ApplyRowGroups::Group &group, Vector &output, Vector &errors, idx_t offset) {
+		input.Destroy();
+		input.InitializeEmpty(input_types);
+		for (idx_t c = 0; c < arg_count; c++) {
+			input.data[c].Slice(args.data[c + 1], group.sel, group.count);
+		}
+		input.SetCardinality(group.count);
+		try {
+			ExecuteApplyTarget(lstate.GetExprTarget(group.func_name, input_types), input, output, offset);
+		} catch (const Exception &e) {
+			throw InvalidInputException("apply_expr('%s'): %s", group.func_name, e.what());
+		}
+	});
+}
+
+//===--------------------------------------------------------------------===//
+// apply_map(func VARCHAR, list LIST, ...args ANY) -> LIST
+// apply_filter(pred VARCHAR, list LIST, ...args ANY) -> LIST
+//===--------------------------------------------------------------------===//
+//
+// Call a function by name on every element of a list, to transform the elements or to keep
+// those for which it returns true:
+//
+//   SELECT apply_map('upper', ['a', 'b']);            -- [A, B]
+//   SELECT apply_filter('isfinite', [1.0, 'inf']);    -- [1.0]
+//
+// Extra arguments follow the element, with the values of the element's row. The function
+// runs vectorized over the list's child vector, STANDARD_VECTOR_SIZE elements per call,
+// and the result lists are built from offsets without per-element values.
+
+// The list argument (argument 1) of apply_map, apply_filter and apply_reduce. An ARRAY or
+// an untyped NULL is cast to a LIST.
+static void BindApplyListArgument(ClientContext &context, const string &caller, ScalarFunction &bound_function,
+                                  vector<unique_ptr<Expression>> &arguments) {
+	auto &list_type = arguments[1]->return_type;
+	if (list_type.id() == LogicalTypeId::ARRAY) {
+		auto child_type = ArrayType::GetChildType(list_type);
+		arguments[1] =
+		    BoundCastExpression::AddCastToType(context, std::move(arguments[1]), LogicalType::LIST(child_type));
+	} else if (list_type.id() == LogicalTypeId::SQLNULL) {
+		arguments[1] = BoundCastExpression::AddCastToType(context, std::move(arguments[1]),
+		                                                  LogicalType::LIST(LogicalType::SQLNULL));
+	} else if (list_type.id() != LogicalTypeId::LIST) {
+		throw BinderException("%s: expected a LIST, got %s", caller, list_type.ToString());
+	}
+	bound_function.arguments[1] = arguments[1]->return_type;
+}
+
+static unique_ptr<FunctionData> BindApplyList(ClientContext &context, ScalarFunction &bound_function,
+                                              vector<unique_ptr<Expression>> &arguments) {
+	// Shared by apply_map and apply_filter
+	auto caller = bound_function.name;
+	bool filter = caller == "apply_filter";
+	auto returns = filter ? LogicalType(LogicalTypeId::INVALID) : TakeReturnsArgument(context, caller, arguments);
+	if (arguments.size() < 2) {
+		throw BinderException("%s: expected %s(func, list, ...args)", caller, caller);
+	}
+	BindApplyListArgument(context, caller, bound_function, arguments);
+
+	if (filter) {
+		bound_function.return_type = arguments[1]->return_type;
+		return nullptr;
+	}
+	if (returns.id() != LogicalTypeId::INVALID) {
+		if (returns.id() != LogicalTypeId::LIST) {
+			throw BinderException("%s: returns must be a LIST type, got %s", caller, returns.ToString());
+		}
+		bound_function.return_type = returns;
+		return nullptr;
+	}
+
+	// With a constant name, the element type of the result is the function's return type
+	bound_function.return_type = LogicalType::LIST(LogicalType::VARCHAR);
+	if (!arguments[0]->IsFoldable()) {
+		return nullptr;
+	}
+	auto func_name_val = ExpressionExecutor::EvaluateScalar(context, *arguments[0]);
+	if (func_name_val.IsNull() || !IsValidIdentifier(StringValue::Get(func_name_val))) {
+		return nullptr;
+	}
+	vector<LogicalType> input_types {ListType::GetChildType(arguments[1]->return_type)};
+	for (idx_t i = 2; i < arguments.size(); i++) {
+		input_types.push_back(arguments[i]->return_type);
+	}
+	try {
+		auto target =
+		    MakeApplyTarget(context, StringValue::Get(func_name_val), input_types, input_types.size(), {});
+		if (target->expr) {
+			bound_function.return_type = LogicalType::LIST(target->expr->return_type);
+		}
+	} catch (const Exception &) {
+		// Reported when the call runs, as for apply()
+	}
+	return nullptr;
+}
+
+// Call `target` on the elements of the lists of a group's rows, one vectorized call per
+// STANDARD_VECTOR_SIZE elements: argument 0 is the element, then the extra arguments of its
+// row. Results are written to `output` from `offset` on, in element order.
+static void ExecuteApplyElements(ClientContext &context, ApplyBoundTarget &target, const string &func_name,
+                                 DataChunk &args, const UnifiedVectorFormat &list_data,
+                                 const ApplyRowGroups::Group &group, const vector<LogicalType> &input_types,
+                                 Vector &output, idx_t offset) {
+	auto list_entries = UnifiedVectorFormat::GetData<list_entry_t>(list_data);
+	auto &child = ListVector::GetEntry(args.data[1]);
+	SelectionVector element_sel(STANDARD_VECTOR_SIZE);
+	SelectionVector row_sel(STANDARD_VECTOR_SIZE);
+	idx_t batch_count = 0;
+	auto flush = [&]() {
+		DataChunk input;
+		input.InitializeEmpty(input_types);
+		input.data[0].Slice(child, element_sel, batch_count);
+		for (idx_t c = 1; c < input_types.size(); c++) {
+			input.data[c].Slice(args.data[c + 1], row_sel, batch_count);
+		}
+		input.SetCardinality(batch_count);
+		ExecuteApplyGroup(context, target, func_name, input, input_types.size(), {}, output, offset);
+		offset += batch_count;
+		batch_count = 0;
+		// The slices of the next batch must not share these selections
+		element_sel.Initialize(STANDARD_VECTOR_SIZE);
+		row_sel.Initialize(STANDARD_VECTOR_SIZE);
+	};
+	for (idx_t i = 0; i < group.count; i++) {
+		auto row = group.sel.get_index(i);
+		auto &entry = list_entries[list_data.sel->get_index(row)];
+		for (idx_t k = 0; k < entry.length; k++) {
+			element_sel.set_index(batch_count, entry.offset + k);
+			row_sel.set_index(batch_count, row);
+			if (++batch_count == STANDARD_VECTOR_SIZE) {
+				flush();
+			}
+		}
+	}
+	if (batch_count > 0) {
+		flush();
+	}
+}
+
+static void ExecuteApplyListCall(DataChunk &args, ExpressionState &state, Vector &result, bool filter) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &caller = func_expr.function.name;
+	auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<ApplyLocalState>();
+	// Constant inputs are computed once, for a constant result
+	bool all_constant = args.AllConstant();
+	idx_t count = all_constant ? 1 : args.size();
+
+	UnifiedVectorFormat name_data;
+	args.data[0].ToUnifiedFormat(count, name_data);
+	auto names = UnifiedVectorFormat::GetData<string_t>(name_data);
+	auto &list_vector = args.data[1];
+	UnifiedVectorFormat list_data;
+	list_vector.ToUnifiedFormat(count, list_data);
+	auto list_entries = UnifiedVectorFormat::GetData<list_entry_t>(list_data);
+	vector<LogicalType> input_types {ListType::GetChildType(list_vector.GetType())};
+	for (idx_t c = 2; c < args.ColumnCount(); c++) {
+		input_types.push_back(args.data[c].GetType());
+	}
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_entries = FlatVector::GetData<list_entry_t>(result);
+	auto &result_validity = FlatVector::Validity(result);
+	ApplyRowGroups groups(count);
+	for (idx_t i = 0; i < count; i++) {
+		auto name_idx = name_data.sel->get_index(i);
+		if (!name_data.validity.RowIsValid(name_idx) ||
+		    !list_data.validity.RowIsValid(list_data.sel->get_index(i))) {
+			result_validity.SetInvalid(i);
+			continue;
+		}
+		groups.Add(names[name_idx].GetString(), input_types.size(), i);
+	}
+
+	for (auto &group_ptr : groups.groups) {
+		auto &group = *group_ptr;
+		auto &func_name = group.func_name;
+		if (!IsValidIdentifier(func_name)) {
+			throw InvalidInputException("%s: invalid function name '%s'", caller, func_name);
+		}
+		idx_t element_count = 0;
+		for (idx_t i = 0; i < group.count; i++) {
+			element_count += list_entries[list_data.sel->get_index(group.sel.get_index(i))].length;
+		}
+		auto list_size = ListVector::GetListSize(result);
+		try {
+			auto &target = lstate.GetTarget(func_name, input_types, input_types.size(), {});
+			if (!filter) {
+				// Results go straight into the result's child vector
+				ListVector::Reserve(result, list_size + element_count);
+				ExecuteApplyElements(lstate.context, target, func_name, args, list_data, group, input_types,
+				                     ListVector::GetEntry(result), list_size);
+				ListVector::SetListSize(result, list_size + element_count);
+			} else {
+				Vector keep(LogicalType::BOOLEAN, MaxValue<idx_t>(element_count, 1));
+				ExecuteApplyElements(lstate.context, target, func_name, args, list_data, group, input_types, keep,
+				                     0);
+				// Append the kept elements and count them per row
+				UnifiedVectorFormat keep_data;
+				keep.ToUnifiedFormat(element_count, keep_data);
+				auto keep_values = UnifiedVectorFormat::GetData<bool>(keep_data);
+				SelectionVector kept(MaxValue<idx_t>(element_count, 1));
+				idx_t kept_count = 0;
+				idx_t element = 0;
+				for (idx_t i = 0; i < group.count; i++) {
+					auto row = group.sel.get_index(i);
+					auto &entry = list_entries[list_data.sel->get_index(row)];
+					result_entries[row].offset = list_size + kept_count;
+					for (idx_t k = 0; k < entry.length; k++, element++) {
+						auto keep_idx = keep_data.sel->get_index(element);
+						if (keep_data.validity.RowIsValid(keep_idx) && keep_values[keep_idx]) {
+							kept.set_index(kept_count++, entry.offset + k);
+						}
+					}
+					result_entries[row].length = list_size + kept_count - result_entries[row].offset;
+				}
+				ListVector::Append(result, ListVector::GetEntry(list_vector), kept, kept_count);
+				continue;
+			}
+		} catch (const Exception &e) {
+			throw InvalidInputException("%s('%s'): %s", caller, func_name, e.what());
+		}
+		// apply_map keeps the shape of each list
+		idx_t offset = list_size;
+		for (idx_t i = 0; i < group.count; i++) {
+			auto row = group.sel.get_index(i);
+			auto length = list_entries[list_data.sel->get_index(row)].length;
+			result_entries[row] = list_entry_t(offset, length);
+			offset += length;
+		}
+	}
+	if (all_constant) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
+
+static void ApplyMapScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
+	ExecuteApplyListCall(args, state, result, false);
+}
+
+static void ApplyFilterScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
+	ExecuteApplyListCall(args, state, result, true);
+}
+
+//===--------------------------------------------------------------------===//
+// apply_reduce(func VARCHAR, list LIST [, init ANY]) -> ANY
+//===--------------------------------------------------------------------===//
+//
+// Left fold of a list with a binary function called by name: func(func(init, x1), x2)...
+// Without init the first element starts the fold. The accumulator has the type of init, or
+// of the elements without it, and each step's result is cast back to it.
+//
+// Rows are folded in lock-step: step p calls the function once, vectorized, on the
+// accumulators and p-th elements of every row whose list is long enough. Rows of a group
+// are sorted by list length, longest first, so the rows still folding are always a prefix
+// and a row's accumulator is final once its list runs out.
+
+static unique_ptr<FunctionData> BindApplyReduce(ClientContext &context, ScalarFunction &bound_function,
+                                                vector<unique_ptr<Expression>> &arguments) {
+	if (arguments.size() < 2 || arguments.size() > 3) {
+		throw BinderException("apply_reduce: expected apply_reduce(func, list[, init])");
+	}
+	BindApplyListArgument(context, "apply_reduce", bound_function, arguments);
+	auto element_type = ListType::GetChildType(arguments[1]->return_type);
+	if (arguments.size() == 3 && arguments[2]->return_type.id() == LogicalTypeId::SQLNULL) {
+		arguments[2] = BoundCastExpression::AddCastToType(context, std::move(arguments[2]), element_type);
+	}
+	bound_function.return_type = arguments.size() == 3 ? arguments[2]->return_type : element_type;
+	return nullptr;
+}
+
+static void ApplyReduceScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<ApplyLocalState>();
+	bool all_constant = args.AllConstant();
+	idx_t count = all_constant ? 1 : args.size();
+	bool has_init = args.ColumnCount() == 3;
+
+	UnifiedVectorFormat name_data;
+	args.data[0].ToUnifiedFormat(count, name_data);
+	auto names = UnifiedVectorFormat::GetData<string_t>(name_data);
+	auto &list_vector = args.data[1];
+	UnifiedVectorFormat list_data;
+	list_vector.ToUnifiedFormat(count, list_data);
+	auto list_entries = UnifiedVectorFormat::GetData<list_entry_t>(list_data);
+	auto &child = ListVector::GetEntry(list_vector);
+	auto &acc_type = result.GetType();
+	vector<LogicalType> input_types {acc_type, child.GetType()};
+
+	ApplyRowGroups groups(count);
+	for (idx_t i = 0; i < count; i++) {
+		auto name_idx = name_data.sel->get_index(i);
+		if (!name_data.validity.RowIsValid(name_idx) ||
+		    !list_data.validity.RowIsValid(list_data.sel->get_index(i))) {
+			groups.AddNull(i);
+			continue;
+		}
+		groups.Add(names[name_idx].GetString(), 2, i);
+	}
+
+	groups.Execute(result, [&](ApplyRowGroups::Group &group, Vector &output, Vector &, idx_t offset) {
+		auto &func_name = group.func_name;
+		if (!IsValidIdentifier(func_name)) {
+			throw InvalidInputException("apply_reduce: invalid function name '%s'", func_name);
+		}
+		// Longest lists first: the rows still folding at any step are a prefix
+		vector<idx_t> rows(group.count);
+		vector<list_entry_t> entries(group.count);
+		for (idx_t i = 0; i < group.count; i++) {
+			rows[i] = group.sel.get_index(i);
+		}
+		std::stable_sort(rows.begin(), rows.end(), [&](idx_t a, idx_t b) {
+			return list_entries[list_data.sel->get_index(a)].length > list_entries[list_data.sel->get_index(b)].length;
+		});
+		for (idx_t i = 0; i < group.count; i++) {
+			group.sel.set_index(i, rows[i]);
+			entries[i] = list_entries[list_data.sel->get_index(rows[i])];
+		}
+
+		try {
+			auto &target = lstate.GetTarget(func_name, input_types, 2, {});
+			Vector acc(acc_type, group.count);
+			idx_t live = group.count;
+			idx_t position = 0;
+			if (has_init) {
+				VectorOperations::Copy(args.data[2], acc, group.sel, group.count, 0, 0);
+			} else {
+				// The first element starts the fold; empty lists give NULL
+				SelectionVector first(group.count);
+				for (live = 0; live < group.count && entries[live].length > 0; live++) {
+					first.set_index(live, entries[live].offset);
+				}
+				VectorOperations::Copy(child, acc, first, live, 0, 0);
+				for (idx_t i = live; i < group.count; i++) {
+					FlatVector::SetNull(output, offset + i, true);
+				}
+				position = 1;
+			}
+			while (live > 0) {
+				idx_t active = live;
+				while (active > 0 && entries[active - 1].length <= position) {
+					active--;
+				}
+				if (active < live) {
+					// These rows have no elements left
+					VectorOperations::Copy(acc, output, live, active, offset + active);
+					live = active;
+				}
+				if (live == 0) {
+					break;
+				}
+				SelectionVector element_sel(live);
+				for (idx_t i = 0; i < live; i++) {
+					element_sel.set_index(i, entries[i].offset + position);
+				}
+				DataChunk input;
+				input.InitializeEmpty(input_types);
+				input.data[0].Reference(acc);
+				input.data[1].Slice(child, element_sel, live);
+				input.SetCardinality(live);
+				Vector next(acc_type, live);
+				ExecuteApplyGroup(lstate.context, target, func_name, input, 2, {}, next, 0);
+				acc.Reference(next);
+				position++;
+			}
+		} catch (const Exception &e) {
+			throw InvalidInputException("apply_reduce('%s'): %s", func_name, e.what());
+		}
+	});
+	if (all_constant) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// apply_each(func VARCHAR, ...columns ANY) -> STRUCT
+// apply_many(funcs VARCHAR[], ...args ANY) -> STRUCT
+//===--------------------------------------------------------------------===//
+//
+// Fan-out calls returning one STRUCT field per call:
+//
+//   SELECT apply_each('trim', first_name, last_name);   -- {first_name: ..., last_name: ...}
+//   SELECT apply_many(['length', 'md5'], name);        -- {length: ..., md5: ...}
+//
+// apply_each calls one function on each column; columns of the same type share one bound
+// target. apply_many calls each function on the same arguments, which are referenced once
+// into a single input chunk for all calls. Names must be constant, as they define the
+// fields of the result.
+
+struct ApplyFanOutBindData : public FunctionData {
+	explicit ApplyFanOutBindData(vector<string> func_names_p) : func_names(std::move(func_names_p)) {
+	}
+
+	// One name for apply_each, one per field for apply_many
+	vector<string> func_names;
+
+	unique_ptr<FunctionData> Copy() const override {
+		return make_uniq<ApplyFanOutBindData>(func_names);
+	}
+	bool Equals(const FunctionData &other) const override {
+		return func_names == other.Cast<ApplyFanOutBindData>().func_names;
+	}
+};
+
+// Return type of one fan-out call, bound for its types at bind time so errors surface early
+static LogicalType BindApplyFanOutField(ClientContext &context, const string &caller, const string &func_name,
+                                        const vector<LogicalType> &input_types) {
+	if (!IsValidIdentifier(func_name)) {
+		throw BinderException("%s: invalid function name '%s'", caller, func_name);
+	}
+	try {
+		auto target = MakeApplyTarget(context, func_name, input_types, input_types.size(), {});
+		return target->expr ? target->expr->return_type : LogicalType::VARCHAR;
+	} catch (const Exception &e) {
+		throw BinderException("%s('%s'): %s", caller, func_name, e.what());
+	}
+}
+
+// Add a field name to a STRUCT being built, with a suffix if it is already taken
+static void AddApplyFanOutField(child_list_t<LogicalType> &fields, case_insensitive_set_t &taken, string name,
+                                LogicalType type) {
+	auto base = name;
+	for (idx_t n = 2; taken.count(name); n++) {
+		name = base + "_" + to_string(n);
+	}
+	taken.insert(name);
+	fields.emplace_back(std::move(name), std::move(type));
+}
+
+static unique_ptr<FunctionData> BindApplyEach(ClientContext &context, ScalarFunction &bound_function,
+                                              vector<unique_ptr<Expression>> &arguments) {
+	if (arguments.size() < 2) {
+		throw BinderException("apply_each: expected apply_each(func, ...columns)");
+	}
+	if (!arguments[0]->IsFoldable()) {
+		throw BinderException("apply_each: function name must be a constant");
+	}
+	auto func_name_val = ExpressionExecutor::EvaluateScalar(context, *arguments[0]);
+	if (func_name_val.IsNull()) {
+		throw BinderException("apply_each: function name cannot be NULL");
+	}
+	auto func_name = StringValue::Get(func_name_val);
+
+	// One field per column, named after it
+	child_list_t<LogicalType> fields;
+	case_insensitive_set_t taken;
+	for (idx_t i = 1; i < arguments.size(); i++) {
+		auto &arg = *arguments[i];
+		auto type = BindApplyFanOutField(context, "apply_each", func_name, {arg.return_type});
+		AddApplyFanOutField(fields, taken, arg.GetAlias().empty() ? arg.ToString() : arg.GetAlias(), type);
+	}
+	bound_function.return_type = LogicalType::STRUCT(std::move(fields));
+	return make_uniq<ApplyFanOutBindData>(vector<string> {func_name});
+}
+
+static unique_ptr<FunctionData> BindApplyMany(ClientContext &context, ScalarFunction &bound_function,
+                                              vector<unique_ptr<Expression>> &arguments) {
+	if (!arguments[0]->IsFoldable()) {
+		throw BinderException("apply_many: function names must be a constant list");
+	}
+	auto names_val = ExpressionExecutor::EvaluateScalar(context, *arguments[0]);
+	if (names_val.IsNull() || names_val.type().id() != LogicalTypeId::LIST) {
+		throw BinderException("apply_many: function names must be a list such as ['length', 'md5']");
+	}
+	vector<LogicalType> input_types;
+	for (idx_t i = 1; i < arguments.size(); i++) {
+		input_types.push_back(arguments[i]->return_type);
+	}
+
+	// One field per function, named after it
+	vector<string> func_names;
+	child_list_t<LogicalType> fields;
+	case_insensitive_set_t taken;
+	for (auto &name_val : ListValue::GetChildren(names_val)) {
+		if (name_val.IsNull()) {
+			throw BinderException("apply_many: function names cannot be NULL");
+		}
+		auto func_name = name_val.ToString();
+		auto type = BindApplyFanOutField(context, "apply_many", func_name, input_types);
+		AddApplyFanOutField(fields, taken, func_name, type);
+		func_names.push_back(func_name);
+	}
+	if (func_names.empty()) {
+		throw BinderException("apply_many: the list of functions must not be empty");
+	}
+	bound_function.return_type = LogicalType::STRUCT(std::move(fields));
+	return make_uniq<ApplyFanOutBindData>(std::move(func_names));
+}
+
+// Run one fan-out call over the whole chunk into a field of the result
+static void ExecuteApplyFanOutField(ApplyLocalState &lstate, const string &caller, const string &func_name,
+                                    DataChunk &input, Vector &field) {
+	vector<LogicalType> input_types = input.GetTypes();
+	try {
+		auto &target = lstate.GetTarget(func_name, input_types, input_types.size(), {});
+		ExecuteApplyGroup(lstate.context, target, func_name, input, input_types.size(), {}, field, 0);
+	} catch (const Exception &e) {
+		throw InvalidInputException("%s('%s'): %s", caller, func_name, e.what());
+	}
+}
+
+static void ApplyEachScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &bind_data = func_expr.bind_info->Cast<ApplyFanOutBindData>();
+	auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<ApplyLocalState>();
+	bool all_constant = args.AllConstant();
+	auto &fields = StructVector::GetEntries(result);
+	for (idx_t c = 1; c < args.ColumnCount(); c++) {
+		DataChunk input;
+		input.InitializeEmpty({args.data[c].GetType()});
+		input.data[0].Reference(args.data[c]);
+		input.SetCardinality(all_constant ? 1 : args.size());
+		ExecuteApplyFanOutField(lstate, "apply_each", bind_data.func_names[0], input, *fields[c - 1]);
+	}
+	if (all_constant) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
+
+static void ApplyManyScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &bind_data = func_expr.bind_info->Cast<ApplyFanOutBindData>();
+	auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<ApplyLocalState>();
+	bool all_constant = args.AllConstant();
+
+	// The arguments, shared by every call
+	vector<LogicalType> input_types;
+	for (idx_t c = 1; c < args.ColumnCount(); c++) {
+		input_types.push_back(args.data[c].GetType());
+	}
+	DataChunk input;
+	input.InitializeEmpty(input_types);
+	for (idx_t c = 1; c < args.ColumnCount(); c++) {
+		input.data[c - 1].Reference(args.data[c]);
+	}
+	input.SetCardinality(all_constant ? 1 : args.size());
+
+	auto &fields = StructVector::GetEntries(result);
+	for (idx_t k = 0; k < bind_data.func_names.size(); k++) {
+		ExecuteApplyFanOutField(lstate, "apply_many", bind_data.func_names[k], input, *fields[k]);
+	}
+	if (all_constant) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// apply_fields(func VARCHAR, value STRUCT | MAP) -> STRUCT | MAP
+//===--------------------------------------------------------------------===//
+//
+// Call a function on every field of a STRUCT, or every value of a MAP, keeping the shape:
+//
+//   SELECT apply_fields('trim', {a: ' x ', b: ' y '});    -- {'a': x, 'b': y}
+//   SELECT apply_fields('upper', MAP {'k': 'v'});         -- {k=V}
+//
+// The function runs directly on each STRUCT child vector, or on the MAP value vector in
+// slices of STANDARD_VECTOR_SIZE, and is bound once per distinct child type. MAP keys are
+// referenced, not copied. The name must be constant, as it defines the result type.
+
+static unique_ptr<FunctionData> BindApplyFields(ClientContext &context, ScalarFunction &bound_function,
+                                                vector<unique_ptr<Expression>> &arguments) {
+	if (!arguments[0]->IsFoldable()) {
+		throw BinderException("apply_fields: function name must be a constant");
+	}
+	auto func_name_val = ExpressionExecutor::EvaluateScalar(context, *arguments[0]);
+	if (func_name_val.IsNull()) {
+		throw BinderException("apply_fields: function name cannot be NULL");
+	}
+	auto func_name = StringValue::Get(func_name_val);
+
+	auto &input_type = arguments[1]->return_type;
+	if (input_type.id() == LogicalTypeId::STRUCT) {
+		child_list_t<LogicalType> fields;
+		for (auto &child : StructType::GetChildTypes(input_type)) {
+			fields.emplace_back(child.first, BindApplyFanOutField(context, "apply_fields", func_name, {child.second}));
+		}
+		bound_function.return_type = LogicalType::STRUCT(std::move(fields));
+	} else if (input_type.id() == LogicalTypeId::MAP) {
+		auto value_type = BindApplyFanOutField(context, "apply_fields", func_name, {MapType::ValueType(input_type)});
+		bound_function.return_type = LogicalType::MAP(MapType::KeyType(input_type), value_type);
+	} else {
+		throw BinderException("apply_fields: expected a STRUCT or MAP, got %s", input_type.ToString());
+	}
+	bound_function.arguments[1] = input_type;
+	return make_uniq<ApplyFanOutBindData>(vector<string> {func_name});
+}
+
+static void ApplyFieldsScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &func_name = func_expr.bind_info->Cast<ApplyFanOutBindData>().func_names[0];
+	auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<ApplyLocalState>();
+	bool all_constant = args.AllConstant();
+	idx_t count = all_constant ? 1 : args.size();
+	auto &input = args.data[1];
+	input.Flatten(count);
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	FlatVector::SetValidity(result, FlatVector::Validity(input));
+	if (input.GetType().id() == LogicalTypeId::STRUCT) {
+		auto &children = StructVector::GetEntries(input);
+		auto &fields = StructVector::GetEntries(result);
+		for (idx_t c = 0; c < children.size(); c++) {
+			DataChunk field_input;
+			field_input.InitializeEmpty({children[c]->GetType()});
+			field_input.data[0].Reference(*children[c]);
+			field_input.SetCardinality(count);
+			ExecuteApplyFanOutField(lstate, "apply_fields", func_name, field_input, *fields[c]);
+		}
+	} else {
+		// Same entries and keys as the input, new values
+		auto entry_count = ListVector::GetListSize(input);
+		ListVector::Reserve(result, entry_count);
+		memcpy(FlatVector::GetData<list_entry_t>(result), FlatVector::GetData<list_entry_t>(input),
+		       count * sizeof(list_entry_t));
+		MapVector::GetKeys(result).Reference(MapVector::GetKeys(input));
+		auto &values = MapVector::GetValues(input);
+		auto &result_values = MapVector::GetValues(result);
+		for (idx_t offset = 0; offset < entry_count; offset += STANDARD_VECTOR_SIZE) {
+			auto end = MinValue<idx_t>(offset + STANDARD_VECTOR_SIZE, entry_count);
+			DataChunk value_input;
+			value_input.InitializeEmpty({values.GetType()});
+			value_input.data[0].Slice(values, offset, end);
+			value_input.SetCardinality(end - offset);
+			try {
+				auto &target = lstate.GetTarget(func_name, {values.GetType()}, 1, {});
+				ExecuteApplyGroup(lstate.context, target, func_name, value_input, 1, {}, result_values, offset);
+			} catch (const Exception &e) {
+				throw InvalidInputException("apply_fields('%s'): %s", func_name, e.what());
+			}
+		}
+		ListVector::SetListSize(result, entry_count);
+	}
+	if (all_constant) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// apply_agg(func VARCHAR, ...args ANY) -> ANY (aggregate)
+//===--------------------------------------------------------------------===//
+//
+// Calls an aggregate function by name:
+//
+//   SELECT metric, apply_agg('avg', value) FROM facts GROUP BY metric;
+//
+// With a constant name, bind replaces apply_agg with the bound target AggregateFunction,
+// so the state layout and the update/combine/finalize callbacks are the target's own and
+// the aggregate runs exactly like a native call (parallel hash aggregates, DISTINCT,
+// FILTER, ORDER BY and window frames included). A name taken from a column is handled by
+// the tagged-state implementation below.
+
+// Resolve and check an aggregate function name given to apply_agg
+static AggregateFunctionCatalogEntry &GetApplyAggEntry(ClientContext &context, const string &func_name) {
+	if (!IsValidIdentifier(func_name)) {
+		throw BinderException("apply_agg: invalid function name '%s'", func_name);
+	}
+	auto entry = GetFunctionEntryOfType(context, func_name, CatalogType::AGGREGATE_FUNCTION_ENTRY);
+	if (!entry) {
+		if (GetCallableFunctionType(context, func_name) != CatalogType::INVALID) {
+			throw BinderException("apply_agg: '%s' is a scalar function. Use apply() instead.", func_name);
+		}
+		if (TableFunctionExists(context, func_name)) {
+			throw BinderException("apply_agg: '%s' is a table function. Use apply_table() instead.", func_name);
+		}
+		throw BinderException("apply_agg: aggregate function '%s' does not exist", func_name);
+	}
+	return entry->Cast<AggregateFunctionCatalogEntry>();
+}
+
+// Bind the best overload of an aggregate for the given arguments
+static unique_ptr<BoundAggregateExpression> BindApplyAggTarget(ClientContext &context,
+                                                               AggregateFunctionCatalogEntry &entry,
+                                                               vector<unique_ptr<Expression>> children) {
+	ErrorData error;
+	FunctionBinder binder(context);
+	auto best_function = binder.BindFunction(entry.name, entry.functions, children, error);
+	if (!best_function.IsValid()) {
+		throw BinderException("apply_agg('%s'): %s", entry.name, error.Message());
+	}
+	auto target = entry.functions.GetFunctionByOffset(best_function.GetIndex());
+	return binder.BindAggregateFunction(target, std::move(children));
+}
+
+//===--------------------------------------------------------------------===//
+// apply_agg with a per-group name
+//===--------------------------------------------------------------------===//
+//
+//   SELECT metric_id, apply_agg(agg_name, value) FROM facts JOIN metrics USING (metric_id)
+//   GROUP BY metric_id, agg_name;
+//
+// When the name comes from a column it must be the same for every row of a group. Each
+// group keeps a tagged state: the tag identifies the resolved target aggregate, and the
+// target's own state is allocated from the aggregate arena the first time the group sees
+// a row. Rows of a chunk are batched per tag, so the target's update, combine, finalize
+// and destructor callbacks are called once per distinct name per chunk.
+//
+// Targets are resolved (and security-checked) once per distinct name and shared by all
+// threads through the bind data. The return type must be fixed at bind time: the type given
+// with returns := 'TYPE', otherwise DOUBLE when all value arguments are numeric and VARCHAR
+// when they are not. Target results are cast to it.
+
+// A target aggregate resolved from a name seen at runtime
+struct ApplyAggTarget {
+	explicit ApplyAggTarget(AggregateFunction function_p) : function(std::move(function_p)) {
+	}
+
+	AggregateFunction function;
+	unique_ptr<FunctionData> bind_info;
+	// Argument types the target was bound for; inputs are cast to these
+	vector<LogicalType> input_types;
+	idx_t state_size = 0;
+	// Blocked by the security policy: no state is kept and groups finalize to blocked_value
+	bool blocked = false;
+	Value blocked_value;
+};
+
+// Names resolved so far, shared by all threads executing the aggregate
+struct ApplyAggRegistry {
+	mutex lock;
+	weak_ptr<ClientContext> context;
+	vector<LogicalType> arg_types;
+	vector<unique_ptr<ApplyAggTarget>> targets;
+	case_insensitive_map_t<idx_t> tags;
+
+	idx_t Resolve(const string &func_name);
+	ApplyAggTarget &GetTarget(idx_t tag) {
+		lock_guard<mutex> guard(lock);
+		return *targets[tag];
+	}
+};
+
+// Remembers the last target looked up, so rows of the same group do not take the lock
+class ApplyAggTargetLookup {
+public:
+	explicit ApplyAggTargetLookup(ApplyAggRegistry &registry_p) : registry(registry_p) {
+	}
+
+	ApplyAggTarget &Get(idx_t tag) {
+		if (tag != last_tag) {
+			last_target = &registry.GetTarget(tag);
+			last_tag = tag;
+		}
+		return *last_target;
+	}
+
+private:
+	ApplyAggRegistry &registry;
+	idx_t last_tag = DConstants::INVALID_INDEX;
+	optional_ptr<ApplyAggTarget> last_target;
+};
+
+idx_t ApplyAggRegistry::Resolve(const string &func_name) {
+	lock_guard<mutex> guard(lock);
+	auto it = tags.find(func_name);
+	if (it != tags.end()) {
+		return it->second;
+	}
+	auto client = context.lock();
+	if (!client) {
+		throw InternalException("apply_agg: client context is no longer available");
+	}
+	auto &ctx = *client;
+	if (!IsValidIdentifier(func_name)) {
+		throw InvalidInputException("apply_agg: invalid function name '%s'", func_name);
+	}
+
+	unique_ptr<ApplyAggTarget> target;
+	if (!ValidateFunctionCall(ctx, func_name, {})) {
+		target = make_uniq<ApplyAggTarget>(
+		    AggregateFunction(func_name, {}, LogicalType::SQLNULL, nullptr, nullptr, nullptr, nullptr, nullptr));
+		target->blocked = true;
+		target->blocked_value = GetBlockedValue(ctx);
+	} else {
+		try {
+			auto &entry = GetApplyAggEntry(ctx, func_name);
+			vector<unique_ptr<Expression>> children;
+			for (idx_t i = 0; i < arg_types.size(); i++) {
+				children.push_back(make_uniq<BoundReferenceExpression>(arg_types[i], i));
+			}
+			auto bound = BindApplyAggTarget(ctx, entry, std::move(children));
+			if (bound->children.size() != arg_types.size()) {
+				throw InvalidInputException("aggregate requires constant arguments and needs a constant name");
+			}
+			target = make_uniq<ApplyAggTarget>(bound->function);
+			target->bind_info = std::move(bound->bind_info);
+			for (auto &child : bound->children) {
+				target->input_types.push_back(child->return_type);
+			}
+			target->state_size = target->function.state_size(target->function);
+		} catch (const Exception &e) {
+			throw InvalidInputException("apply_agg('%s'): %s", func_name, e.what());
+		}
+	}
+	auto tag = targets.size();
+	targets.push_back(std::move(target));
+	tags[func_name] = tag;
+	return tag;
+}
+
+struct ApplyAggDynamicBindData : public FunctionData {
+	shared_ptr<ApplyAggRegistry> registry;
+
+	unique_ptr<FunctionData> Copy() const override {
+		auto result = make_uniq<ApplyAggDynamicBindData>();
+		result->registry = registry;
+		return std::move(result);
+	}
+	bool Equals(const FunctionData &other) const override {
+		return registry == other.Cast<ApplyAggDynamicBindData>().registry;
+	}
+};
+
+// Per-group state: which target, and the target's state
+struct ApplyAggDynamicState {
+	idx_t tag;
+	data_ptr_t target_state;
+};
+
+// Rows of one chunk that belong to groups with the same tag
+struct ApplyAggTagBatch {
+	explicit ApplyAggTagBatch(idx_t tag_p) : tag(tag_p), sel(STANDARD_VECTOR_SIZE), states(LogicalType::POINTER) {
+	}
+
+	idx_t tag;
+	SelectionVector sel;
+	Vector states;
+	idx_t count = 0;
+	// For combine: source states matching `states`
+	unique_ptr<Vector> sources;
+};
+
+class ApplyAggBatcher {
+public:
+	ApplyAggTagBatch &Get(idx_t tag) {
+		if (last && last->tag == tag) {
+			return *last;
+		}
+		for (auto &batch : batches) {
+			if (batch->tag == tag) {
+				last = batch.get();
+				return *last;
+			}
+		}
+		batches.push_back(make_uniq<ApplyAggTagBatch>(tag));
+		last = batches.back().get();
+		return *last;
+	}
+
+	void Add(idx_t tag, idx_t row, data_ptr_t target_state) {
+		auto &batch = Get(tag);
+		batch.sel.set_index(batch.count, row);
+		FlatVector::GetData<data_ptr_t>(batch.states)[batch.count] = target_state;
+		batch.count++;
+	}
+
+	vector<unique_ptr<ApplyAggTagBatch>> batches;
+
+private:
+	optional_ptr<ApplyAggTagBatch> last;
+};
+
+static ApplyAggRegistry &GetApplyAggRegistry(AggregateInputData &aggr_input_data) {
+	return *aggr_input_data.bind_data->Cast<ApplyAggDynamicBindData>().registry;
+}
+
+static idx_t ApplyAggDynamicStateSize(const AggregateFunction &function) {
+	return sizeof(ApplyAggDynamicState);
+}
+
+static void ApplyAggDynamicInitialize(const AggregateFunction &function, data_ptr_t state_p) {
+	auto state = reinterpret_cast<ApplyAggDynamicState *>(state_p);
+	state->tag = DConstants::INVALID_INDEX;
+	state->target_state = nullptr;
+}
+
+// Give a state its target the first time it is used, and check the name did not change
+static void AssignApplyAggTarget(ApplyAggRegistry &registry, ApplyAggDynamicState &state, idx_t tag,
+                                 ApplyAggTarget &target, ArenaAllocator &allocator) {
+	if (state.tag == tag) {
+		return;
+	}
+	if (state.tag != DConstants::INVALID_INDEX) {
+		throw InvalidInputException("apply_agg: function name must be constant within each group (got '%s' and '%s')",
+		                            registry.GetTarget(state.tag).function.name, target.function.name);
+	}
+	state.tag = tag;
+	if (!target.blocked) {
+		state.target_state = allocator.AllocateAligned(target.state_size);
+		target.function.initialize(target.function, state.target_state);
+	}
+}
+
+static void ApplyAggDynamicUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+                                  Vector &states, idx_t count) {
+	auto &registry = GetApplyAggRegistry(aggr_input_data);
+
+	UnifiedVectorFormat name_data;
+	inputs[0].ToUnifiedFormat(count, name_data);
+	auto names = UnifiedVectorFormat::GetData<string_t>(name_data);
+	UnifiedVectorFormat state_data;
+	states.ToUnifiedFormat(count, state_data);
+	auto state_ptrs = UnifiedVectorFormat::GetData<ApplyAggDynamicState *>(state_data);
+
+	// Resolve names to tags (caching the last name) and batch rows per tag
+	ApplyAggTargetLookup lookup(registry);
+	ApplyAggBatcher batcher;
+	string_t last_name;
+	idx_t last_tag = DConstants::INVALID_INDEX;
+	for (idx_t i = 0; i < count; i++) {
+		auto name_idx = name_data.sel->get_index(i);
+		if (!name_data.validity.RowIsValid(name_idx)) {
+			continue;
+		}
+		auto &name = names[name_idx];
+		if (last_tag == DConstants::INVALID_INDEX || !(name == last_name)) {
+			last_tag = registry.Resolve(name.GetString());
+			last_name = name;
+		}
+		auto &target = lookup.Get(last_tag);
+		auto &state = *state_ptrs[state_data.sel->get_index(i)];
+		AssignApplyAggTarget(registry, state, last_tag, target, aggr_input_data.allocator);
+		if (!target.blocked) {
+			batcher.Add(last_tag, i, state.target_state);
+		}
+	}
+
+	for (auto &batch : batcher.batches) {
+		auto &target = lookup.Get(batch->tag);
+		vector<Vector> target_inputs;
+		for (idx_t c = 1; c < input_count; c++) {
+			Vector sliced(inputs[c], batch->sel, batch->count);
+			auto &target_type = target.input_types[c - 1];
+			if (sliced.GetType() == target_type) {
+				target_inputs.push_back(std::move(sliced));
+			} else {
+				Vector cast_input(target_type, batch->count);
+				VectorOperations::DefaultCast(sliced, cast_input, batch->count);
+				target_inputs.push_back(std::move(cast_input));
+			}
+		}
+		AggregateInputData target_input_data(target.bind_info.get(), aggr_input_data.allocator,
+		                                     aggr_input_data.combine_type);
+		target.function.update(target_inputs.data(), target_input_data, target_inputs.size(), batch->states,
+		                       batch->count);
+	}
+}
+
+static void ApplyAggDynamicSimpleUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+                                        data_ptr_t state, idx_t count) {
+	Vector states(Value::POINTER(CastPointerToValue(state)));
+	ApplyAggDynamicUpdate(inputs, aggr_input_data, input_count, states, count);
+}
+
+static void ApplyAggDynamicCombine(Vector &source, Vector &target_states, AggregateInputData &aggr_input_data,
+                                   idx_t count) {
+	auto &registry = GetApplyAggRegistry(aggr_input_data);
+	auto sources = FlatVector::GetData<ApplyAggDynamicState *>(source);
+	auto targets = FlatVector::GetData<ApplyAggDynamicState *>(target_states);
+
+	ApplyAggTargetLookup lookup(registry);
+	ApplyAggBatcher batcher;
+	for (idx_t i = 0; i < count; i++) {
+		auto &src = *sources[i];
+		if (src.tag == DConstants::INVALID_INDEX) {
+			continue;
+		}
+		auto &target = lookup.Get(src.tag);
+		auto &tgt = *targets[i];
+		AssignApplyAggTarget(registry, tgt, src.tag, target, aggr_input_data.allocator);
+		if (target.blocked) {
+			continue;
+		}
+		auto &batch = batcher.Get(src.tag);
+		if (!batch.sources) {
+			batch.sources = make_uniq<Vector>(LogicalType::POINTER);
+		}
+		FlatVector::GetData<data_ptr_t>(*batch.sources)[batch.count] = src.target_state;
+		batcher.Add(src.tag, i, tgt.target_state);
+	}
+
+	for (auto &batch : batcher.batches) {
+		auto &target = lookup.Get(batch->tag);
+		AggregateInputData target_input_data(target.bind_info.get(), aggr_input_data.allocator,
+		                                     aggr_input_data.combine_type);
+		target.function.combine(*batch->sources, batch->states, target_input_data, batch->count);
+	}
+}
+
+static void ApplyAggDynamicFinalize(Vector &states, AggregateInputData &aggr_input_data, Vector &result, idx_t count,
+                                    idx_t offset) {
+	auto &registry = GetApplyAggRegistry(aggr_input_data);
+	UnifiedVectorFormat state_data;
+	states.ToUnifiedFormat(count, state_data);
+	auto state_ptrs = UnifiedVectorFormat::GetData<ApplyAggDynamicState *>(state_data);
+
+	// Results are gathered in `finalized`, one batch after the other, and copied to the
+	// result in row order through `row_sel`. Groups without a target come first.
+	Vector finalized(result.GetType(), count);
+	SelectionVector row_sel(count);
+	idx_t position = 0;
+	ApplyAggTargetLookup lookup(registry);
+	ApplyAggBatcher batcher;
+	for (idx_t i = 0; i < count; i++) {
+		auto &state = *state_ptrs[state_data.sel->get_index(i)];
+		if (state.tag == DConstants::INVALID_INDEX) {
+			// No non-NULL name was seen in this group
+			FlatVector::SetNull(finalized, position, true);
+			row_sel.set_index(i, position++);
+			continue;
+		}
+		auto &target = lookup.Get(state.tag);
+		if (target.blocked) {
+			finalized.SetValue(position, target.blocked_value.DefaultCastAs(result.GetType()));
+			row_sel.set_index(i, position++);
+			continue;
+		}
+		batcher.Add(state.tag, i, state.target_state);
+	}
+
+	for (auto &batch : batcher.batches) {
+		auto &target = lookup.Get(batch->tag);
+		AggregateInputData target_input_data(target.bind_info.get(), aggr_input_data.allocator,
+		                                     aggr_input_data.combine_type);
+		Vector target_result(target.function.return_type, batch->count);
+		target.function.finalize(batch->states, target_input_data, target_result, batch->count, 0);
+
+		if (target_result.GetType() == result.GetType()) {
+			VectorOperations::Copy(target_result, finalized, batch->count, 0, position);
+		} else {
+			Vector cast_result(result.GetType(), batch->count);
+			VectorOperations::DefaultCast(target_result, cast_result, batch->count);
+			VectorOperations::Copy(cast_result, finalized, batch->count, 0, position);
+		}
+		for (idx_t j = 0; j < batch->count; j++) {
+			row_sel.set_index(batch->sel.get_index(j), position++);
+		}
+	}
+	VectorOperations::Copy(finalized, result, row_sel, count, 0, offset);
+}
+
+static void ApplyAggDynamicDestructor(Vector &states, AggregateInputData &aggr_input_data, idx_t count) {
+	auto &registry = GetApplyAggRegistry(aggr_input_data);
+	auto state_ptrs = FlatVector::GetData<ApplyAggDynamicState *>(states);
+
+	ApplyAggTargetLookup lookup(registry);
+	ApplyAggBatcher batcher;
+	for (idx_t i = 0; i < count; i++) {
+		auto &state = *state_ptrs[i];
+		if (state.tag == DConstants::INVALID_INDEX || !lookup.Get(state.tag).function.destructor) {
+			continue;
+		}
+		batcher.Add(state.tag, i, state.target_state);
+	}
+
+	for (auto &batch : batcher.batches) {
+		auto &target = lookup.Get(batch->tag);
+		AggregateInputData target_input_data(target.bind_info.get(), aggr_input_data.allocator,
+		                                     aggr_input_data.combine_type);
+		target.function.destructor(batch->states, target_input_data, batch->count);
+	}
+}
+
+static unique_ptr<FunctionData> BindApplyAggDynamic(ClientContext &context, AggregateFunction &function,
+                                                    vector<unique_ptr<Expression>> &arguments,
+                                                    const LogicalType &returns) {
+	auto bind_data = make_uniq<ApplyAggDynamicBindData>();
+	bind_data->registry = make_shared_ptr<ApplyAggRegistry>();
+	bind_data->registry->context = context.shared_from_this();
+
+	// Fix the argument list so the binder keeps (and does not cast) every value argument
+	function.arguments = {LogicalType::VARCHAR};
+	function.varargs = LogicalType::INVALID;
+	bool all_numeric = arguments.size() > 1;
+	for (idx_t i = 1; i < arguments.size(); i++) {
+		function.arguments.push_back(arguments[i]->return_type);
+		bind_data->registry->arg_types.push_back(arguments[i]->return_type);
+		all_numeric = all_numeric && arguments[i]->return_type.IsNumeric();
+	}
+	if (returns.id() != LogicalTypeId::INVALID) {
+		function.return_type = returns;
+	} else {
+		function.return_type = all_numeric ? LogicalType::DOUBLE : LogicalType::VARCHAR;
+	}
+
+	function.state_size = ApplyAggDynamicStateSize;
+	function.initialize = ApplyAggDynamicInitialize;
+	function.update = ApplyAggDynamicUpdate;
+	function.simple_update = ApplyAggDynamicSimpleUpdate;
+	function.combine = ApplyAggDynamicCombine;
+	function.finalize = ApplyAggDynamicFinalize;
+	function.destructor = ApplyAggDynamicDestructor;
+	function.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	return std::move(bind_data);
+}
+
+// Evaluate and check the constant name argument of apply_agg / apply_window
+static string GetConstantAggName(ClientContext &context, const string &caller,
+                                 vector<unique_ptr<Expression>> &arguments) {
+	if (!arguments[0]->IsFoldable()) {
+		throw BinderException("%s: function name must be a constant", caller);
+	}
+	auto func_name_val = ExpressionExecutor::EvaluateScalar(context, *arguments[0]);
+	if (func_name_val.IsNull()) {
+		throw BinderException("%s: function name cannot be NULL", caller);
+	}
+	string func_name = StringValue::Get(func_name_val);
+	if (!IsValidIdentifier(func_name)) {
+		throw BinderException("%s: invalid function name '%s'", caller, func_name);
+	}
+	if (!ValidateFunctionCall(context, func_name, {})) {
+		throw BinderException("%s: function '%s' is blocked by security policy", caller, func_name);
+	}
+	return func_name;
+}
+
+static unique_ptr<FunctionData> BindApplyAggConstant(ClientContext &context, AggregateFunction &function,
+                                                     vector<unique_ptr<Expression>> &arguments,
+                                                     const string &func_name) {
+	auto &entry = GetApplyAggEntry(context, func_name);
+
+	vector<unique_ptr<Expression>> children;
+	for (idx_t i = 1; i < arguments.size(); i++) {
+		children.push_back(std::move(arguments[i]));
+	}
+	auto bound = BindApplyAggTarget(context, entry, std::move(children));
+
+	// Become the target: from here on the aggregate is indistinguishable from a direct call
+	function = bound->function;
+	arguments = std::move(bound->children);
+	return std::move(bound->bind_info);
+}
+
+static unique_ptr<FunctionData> BindApplyAgg(ClientContext &context, AggregateFunction &function,
+                                             vector<unique_ptr<Expression>> &arguments) {
+	if (arguments.empty()) {
+		throw BinderException("apply_agg requires at least a function name");
+	}
+	auto returns = TakeReturnsArgument(context, "apply_agg", arguments);
+	if (!arguments[0]->IsFoldable()) {
+		return BindApplyAggDynamic(context, function, arguments, returns);
+	}
+	auto func_name = GetConstantAggName(context, "apply_agg", arguments);
+	auto bind_data = BindApplyAggConstant(context, function, arguments, func_name);
+	// A constant name runs the target itself, whose result type cannot be changed
+	if (returns.id() != LogicalTypeId::INVALID && returns != function.return_type) {
+		throw BinderException("apply_agg('%s'): returns := '%s' differs from its result type %s; cast the result "
+		                      "instead",
+		                      func_name, returns.ToString(), function.return_type.ToString());
+	}
+	return bind_data;
+}
+
+//===--------------------------------------------------------------------===//
+// apply_window(func VARCHAR, ...args ANY) OVER (...) -> ANY
+//===--------------------------------------------------------------------===//
+//
+//   SELECT apply_window('lag', price, 1) OVER (PARTITION BY ticker ORDER BY day) FROM prices;
+//
+// Aggregates (sum, avg, ...) bind exactly as in apply_agg, so moving aggregates use DuckDB's
+// segment trees. Ranking and navigation functions (row_number, lag, ntile, ...) are not
+// catalog entries: window syntax with an unknown name always binds as an aggregate. For
+// those, apply_window binds a placeholder aggregate that records the target, and the
+// optimizer extension below rewrites the BoundWindowExpression into the native window
+// expression before physical planning, so streaming and partitioned window execution
+// are the same as for a direct call.
+//
+// The rewrite is an optimizer extension, so it depends on the optimizer: with
+// disable_optimizer, or 'extension' in disabled_optimizers, the placeholder reaches
+// execution and fails. Extensions run after the built-in optimizers, which therefore see
+// the placeholder as an ordinary window aggregate. Aggregates are bound natively and do
+// not depend on the rewrite.
+
+struct ApplyWindowTarget {
+	const char *name;
+	ExpressionType type;
+	idx_t min_args;
+	idx_t max_args;
+};
+
+static const ApplyWindowTarget APPLY_WINDOW_TARGETS[] = {
+    {"row_number", ExpressionType::WINDOW_ROW_NUMBER, 0, 0},
+    {"rank", ExpressionType::WINDOW_RANK, 0, 0},
+    {"dense_rank", ExpressionType::WINDOW_RANK_DENSE, 0, 0},
+    {"percent_rank", ExpressionType::WINDOW_PERCENT_RANK, 0, 0},
+    {"cume_dist", ExpressionType::WINDOW_CUME_DIST, 0, 0},
+    {"ntile", ExpressionType::WINDOW_NTILE, 1, 1},
+    {"lag", ExpressionType::WINDOW_LAG, 1, 3},
+    {"lead", ExpressionType::WINDOW_LEAD, 1, 3},
+    {"first_value", ExpressionType::WINDOW_FIRST_VALUE, 1, 1},
+    {"last_value", ExpressionType::WINDOW_LAST_VALUE, 1, 1},
+    {"nth_value", ExpressionType::WINDOW_NTH_VALUE, 2, 2},
+};
+
+static optional_ptr<const ApplyWindowTarget> GetApplyWindowTarget(const string &func_name) {
+	for (auto &target : APPLY_WINDOW_TARGETS) {
+		if (StringUtil::CIEquals(func_name, target.name)) {
+			return &target;
+		}
+	}
+	return nullptr;
+}
+
+struct ApplyWindowBindData : public FunctionData {
+	string func_name;
+	ExpressionType type = ExpressionType::INVALID;
+
+	unique_ptr<FunctionData> Copy() const override {
+		auto result = make_uniq<ApplyWindowBindData>();
+		result->func_name = func_name;
+		result->type = type;
+		return std::move(result);
+	}
+	bool Equals(const FunctionData &other) const override {
+		auto &o = other.Cast<ApplyWindowBindData>();
+		return func_name == o.func_name && type == o.type;
+	}
+};
+
+static idx_t ApplyWindowStateSize(const AggregateFunction &function) {
+	return sizeof(idx_t);
+}
+
+static void ApplyWindowInitialize(const AggregateFunction &function, data_ptr_t state) {
+}
+
+// Only reached when the placeholder was not rewritten: no OVER clause, or the optimizer is disabled
+static void ApplyWindowUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count, Vector &states,
+                              idx_t count) {
+	auto &bind_data = aggr_input_data.bind_data->Cast<ApplyWindowBindData>();
+	throw InvalidInputException("apply_window('%s'): window function requires an OVER clause, and the optimizer "
+	                            "extension that rewrites it (skipped with disable_optimizer or "
+	                            "disabled_optimizers = 'extension')",
+	                            bind_data.func_name);
+}
+
+static void ApplyWindowCombine(Vector &source, Vector &target, AggregateInputData &aggr_input_data, idx_t count) {
+}
+
+static void ApplyWindowFinalize(Vector &states, AggregateInputData &aggr_input_data, Vector &result, idx_t count,
+                                idx_t offset) {
+	ApplyWindowUpdate(nullptr, aggr_input_data, 0, states, count);
+}
+
+static unique_ptr<FunctionData> BindApplyWindow(ClientContext &context, AggregateFunction &function,
+                                                vector<unique_ptr<Expression>> &arguments) {
+	auto func_name = GetConstantAggName(context, "apply_window", arguments);
+	auto target = GetApplyWindowTarget(func_name);
+	if (!target) {
+		// Not a ranking or navigation function: an aggregate used as a window aggregate
+		return BindApplyAggConstant(context, function, arguments, func_name);
+	}
+
+	auto value_count = arguments.size() - 1;
+	if (value_count < target->min_args || value_count > target->max_args) {
+		throw BinderException("apply_window: '%s' takes %d to %d arguments, got %d", func_name, target->min_args,
+		                      target->max_args, value_count);
+	}
+
+	// Argument types expected by the native window expression; the binder adds the casts
+	vector<LogicalType> arg_types;
+	LogicalType return_type;
+	switch (target->type) {
+	case ExpressionType::WINDOW_PERCENT_RANK:
+	case ExpressionType::WINDOW_CUME_DIST:
+		return_type = LogicalType::DOUBLE;
+		break;
+	case ExpressionType::WINDOW_NTILE:
+		arg_types = {LogicalType::BIGINT};
+		return_type = LogicalType::BIGINT;
+		break;
+	case ExpressionType::WINDOW_LAG:
+	case ExpressionType::WINDOW_LEAD:
+		return_type = arguments[1]->return_type;
+		arg_types = {return_type, LogicalType::BIGINT, return_type};
+		break;
+	case ExpressionType::WINDOW_NTH_VALUE:
+		return_type = arguments[1]->return_type;
+		arg_types = {return_type, LogicalType::BIGINT};
+		break;
+	case ExpressionType::WINDOW_FIRST_VALUE:
+	case ExpressionType::WINDOW_LAST_VALUE:
+		return_type = arguments[1]->return_type;
+		arg_types = {return_type};
+		break;
+	default:
+		return_type = LogicalType::BIGINT;
+		break;
+	}
+
+	// Drop the name; keep only the value arguments
+	arguments.erase(arguments.begin());
+	arg_types.resize(arguments.size());
+
+	function.arguments = arg_types;
+	function.varargs = LogicalType::INVALID;
+	function.return_type = return_type;
+	function.state_size = ApplyWindowStateSize;
+	function.initialize = ApplyWindowInitialize;
+	function.update = ApplyWindowUpdate;
+	function.combine = ApplyWindowCombine;
+	function.finalize = ApplyWindowFinalize;
+	function.simple_update = nullptr;
+	function.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+
+	auto bind_data = make_uniq<ApplyWindowBindData>();
+	bind_data->func_name = target->name;
+	bind_data->type = target->type;
+	return std::move(bind_data);
+}
+
+// Turn a placeholder window aggregate into the native window expression
+static void RewriteApplyWindow(BoundWindowExpression &wexpr) {
+	if (wexpr.GetExpressionType() != ExpressionType::WINDOW_AGGREGATE || !wexpr.aggregate ||
+	    wexpr.aggregate->name != "apply_window" || !wexpr.bind_info) {
+		return;
+	}
+	auto &bind_data = wexpr.bind_info->Cast<ApplyWindowBindData>();
+	auto type = bind_data.type;
+	auto children = std::move(wexpr.children);
+	wexpr.children.clear();
+
+	switch (type) {
+	case ExpressionType::WINDOW_LAG:
+	case ExpressionType::WINDOW_LEAD:
+		wexpr.children.push_back(std::move(children[0]));
+		if (children.size() > 1) {
+			wexpr.offset_expr = std::move(children[1]);
+		}
+		if (children.size() > 2) {
+			wexpr.default_expr = std::move(children[2]);
+		}
+		break;
+	case ExpressionType::WINDOW_NTH_VALUE:
+		wexpr.children.push_back(std::move(children[0]));
+		wexpr.offset_expr = std::move(children[1]);
+		break;
+	default:
+		// ntile, first_value and last_value take their argument as the only child
+		for (auto &child : children) {
+			wexpr.children.push_back(std::move(child));
+		}
+		break;
+	}
+
+	wexpr.SetExpressionTypeUnsafe(type);
+	wexpr.aggregate.reset();
+	wexpr.bind_info.reset();
+}
+
+static void RewriteApplyWindowOperators(LogicalOperator &op) {
+	for (auto &child : op.children) {
+		RewriteApplyWindowOperators(*child);
+	}
+	if (op.type != LogicalOperatorType::LOGICAL_WINDOW) {
+		return;
+	}
+	for (auto &expr : op.expressions) {
+		if (expr->GetExpressionClass() == ExpressionClass::BOUND_WINDOW) {
+			RewriteApplyWindow(expr->Cast<BoundWindowExpression>());
+		}
+	}
+}
+
+static void ApplyWindowOptimize(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan) {
+	RewriteApplyWindowOperators(*plan);
+}
+
+//===--------------------------------------------------------------------===//
+// apply_table(func VARCHAR, ...args ANY) -> TABLE
+//===--------------------------------------------------------------------===//
+
+// Build a TableFunctionRef for func_name(arg1, arg2, ..., name := value, ...) directly from
+// bound Values. No SQL text is generated or re-parsed, so construction is linear in the
+// number of arguments and every argument keeps its exact type.
+static unique_ptr<TableFunctionRef> MakeTableFunctionRef(const string &func_name, const vector<Value> &positional,
+                                                         const named_parameter_map_t &named) {
+	vector<unique_ptr<ParsedExpression>> children;
+	children.reserve(positional.size() + named.size());
+	for (auto &val : positional) {
+		children.push_back(make_uniq<ConstantExpression>(val));
+	}
+	for (auto &kv : named) {
+		auto child = make_uniq<ConstantExpression>(kv.second);
+		child->alias = kv.first;
+		children.push_back(std::move(child));
+	}
+
+	auto table_function = make_uniq<TableFunctionRef>();
+	table_function->function = make_uniq<FunctionExpression>(func_name, std::move(children));
+	return table_function;
+}
+
+// Build SELECT * FROM func_name(args..., name := value, ...) as a statement
+static unique_ptr<SelectStatement> MakeTableFunctionSelect(const string &func_name, const vector<Value> &positional,
+                                                           const named_parameter_map_t &named) {
+	auto node = make_uniq<SelectNode>();
+	node->select_list.push_back(make_uniq<StarExpression>());
+	node->from_table = MakeTableFunctionRef(func_name, positional, named);
+	auto statement = make_uniq<SelectStatement>();
+	statement->node = std::move(node);
+	return statement;
+}
+
+//===--------------------------------------------------------------------===//
+// Result cache for apply_table / apply_table_with (cache := true)
+//===--------------------------------------------------------------------===//
+//
+// Repeated calls with identical arguments can be served from memory:
+//
+//   SELECT * FROM apply_table_with('daily_report', args := ['2024-01-01'], cache := true);
+//
+// Results are materialized into ColumnDataCollections, which are buffer-managed and
+// can spill, and are kept in a database-wide LRU cache:
+//   - key: function name, argument values, default database and catalog version.
+//     Any DDL bumps the catalog version and invalidates earlier entries. Data changes
+//     (INSERT/UPDATE/DELETE) do not; use func_apply_clear_cache() after loads.
+//   - limit: total memory of all entries, set with func_apply_set_cache_limit().
+//   - volatile targets (whose plan contains any function that is not CONSISTENT,
+//     such as random() or now()) are never cached; the verdict is remembered.
+//
+// The cache lives in the database's ObjectCache so it is destroyed with the database.
+// bind_replace cannot return a collection directly, so a hit or fill is handed to the
+// internal __func_apply_cache_scan() table function through a pin held by the session.
+//
+// A miss is filled on a separate connection, which sees neither the session's TEMP objects
+// nor the uncommitted changes of an explicit transaction. Calls made while either exists
+// bypass the cache.
+
+static constexpr idx_t DEFAULT_RESULT_CACHE_LIMIT = 256ULL * 1024ULL * 1024ULL;
+
+// One cached call result
+struct CachedTableResult {
+	vector<string> names;
+	vector<LogicalType> types;
+	shared_ptr<ColumnDataCollection> collection;
+	// Volatile targets are remembered (without data) so they are not re-checked
+	bool is_volatile = false;
+	idx_t size = 0;
+};
+
+class ApplyTableResultCache : public ObjectCacheEntry {
+public:
+	static string ObjectType() {
+		return "func_apply_result_cache";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+	shared_ptr<CachedTableResult> Lookup(const string &key) {
+		lock_guard<mutex> guard(lock);
+		auto it = entries.find(key);
+		if (it == entries.end()) {
+			return nullptr;
+		}
+		// Move to the front of the LRU list
+		lru.splice(lru.begin(), lru, it->second.second);
+		return it->second.first;
+	}
+
+	void Insert(const string &key, shared_ptr<CachedTableResult> result) {
+		lock_guard<mutex> guard(lock);
+		if (result->size > memory_limit) {
+			// Never cache a single result larger than the whole cache
+			return;
+		}
+		EraseInternal(key);
+		lru.push_front(key);
+		total_size += result->size;
+		entries[key] = make_pair(std::move(result), lru.begin());
+		EvictInternal();
+	}
+
+	void Clear() {
+		lock_guard<mutex> guard(lock);
+		entries.clear();
+		lru.clear();
+		total_size = 0;
+	}
+
+	void SetLimit(idx_t limit) {
+		lock_guard<mutex> guard(lock);
+		memory_limit = limit;
+		EvictInternal();
+	}
+
+private:
+	void EraseInternal(const string &key) {
+		auto it = entries.find(key);
+		if (it == entries.end()) {
+			return;
+		}
+		total_size -= it->second.first->size;
+		lru.erase(it->second.second);
+		entries.erase(it);
+	}
+
+	void EvictInternal() {
+		while (total_size > memory_limit && !lru.empty()) {
+			EraseInternal(lru.back());
+		}
+	}
+
+	mutex lock;
+	idx_t memory_limit = DEFAULT_RESULT_CACHE_LIMIT;
+	idx_t total_size = 0;
+	// Most recently used key at the front
+	std::list<string> lru;
+	unordered_map<string, pair<shared_ptr<CachedTableResult>, std::list<string>::iterator>> entries;
+};
+
+// Results handed from bind_replace to the bind of __func_apply_cache_scan(). Registered on the
+// session, so pins die with it, and dropped when a query ends, also when its bind failed.
+class ApplyCachePins : public ClientContextState {
+public:
+	idx_t Pin(shared_ptr<CachedTableResult> result) {
+		auto pin_id = ++next_pin_id;
+		pinned[pin_id] = std::move(result);
+		return pin_id;
+	}
+
+	shared_ptr<CachedTableResult> Get(idx_t pin_id) const {
+		auto it = pinned.find(pin_id);
+		return it == pinned.end() ? nullptr : it->second;
+	}
+
+	void QueryEnd(ClientContext &context) override {
+		pinned.clear();
+	}
+
+private:
+	idx_t next_pin_id = 0;
+	unordered_map<idx_t, shared_ptr<CachedTableResult>> pinned;
+};
+
+static ApplyCachePins &GetCachePins(ClientContext &context) {
+	return *context.registered_state->GetOrCreate<ApplyCachePins>("func_apply_cache_pins");
+}
+
+static ApplyTableResultCache &GetResultCache(ClientContext &context) {
+	auto &object_cache = ObjectCache::GetObjectCache(context);
+	auto cache = object_cache.GetOrCreate<ApplyTableResultCache>(ApplyTableResultCache::ObjectType());
+	if (!cache) {
+		throw InternalException("func_apply: object cache entry '%s' has an unexpected type",
+		                        ApplyTableResultCache::ObjectType());
+	}
+	return *cache;
+}
+
+// Build the cache key for a call. Named parameters are sorted so the key does not depend
+// on the order in which they were written.
+static string MakeResultCacheKey(ClientContext &context, const string &func_name, const vector<Value> &positional,
+                                 const named_parameter_map_t &named) {
+	auto &db_manager = DatabaseManager::Get(context);
+	auto default_db_name = db_manager.GetDefaultDatabase(context);
+	auto &catalog = Catalog::GetCatalog(context, default_db_name);
+	auto catalog_version = catalog.GetCatalogVersion(context);
+
+	string key = default_db_name + "|";
+	key += catalog_version.IsValid() ? to_string(catalog_version.GetIndex()) : "-";
+	key += "|" + StringUtil::Lower(func_name) + "(";
+	for (auto &val : positional) {
+		key += val.type().ToString() + ":" + val.ToSQLString() + ",";
+	}
+	vector<string> names;
+	for (auto &kv : named) {
+		names.push_back(kv.first);
+	}
+	std::sort(names.begin(), names.end());
+	for (auto &name : names) {
+		auto &val = named.at(name);
+		key += StringUtil::Lower(name) + ":=" + val.type().ToString() + ":" + val.ToSQLString() + ",";
+	}
+	key += ")";
+	return key;
+}
+
+// Detects expressions that may return different results on repeated execution
+class VolatileExpressionFinder : public LogicalOperatorVisitor {
+public:
+	bool found = false;
+
+	void VisitExpression(unique_ptr<Expression> *expression) override {
+		if (!(*expression)->IsConsistent()) {
+			found = true;
+		}
+	}
+};
+
+// Whether a separate connection sees what the session sees: the session must have no TEMP
+// objects and no explicit transaction, whose changes that connection would not see
+static bool SessionVisibleFromConnection(ClientContext &context) {
+	if (!context.transaction.IsAutoCommit()) {
+		return false;
+	}
+	bool has_temp_objects = false;
+	Catalog::GetCatalog(context, TEMP_CATALOG).ScanSchemas(context, [&](SchemaCatalogEntry &schema) {
+		for (auto type : {CatalogType::TABLE_ENTRY, CatalogType::MACRO_ENTRY, CatalogType::TABLE_MACRO_ENTRY,
+		                  CatalogType::SEQUENCE_ENTRY}) {
+			schema.Scan(context, type, [&](CatalogEntry &) { has_temp_objects = true; });
+		}
+	});
+	return !has_temp_objects;
+}
+
+// Whether a miss may be filled on a separate connection. Sessions with a security policy
+// bypass the cache: the cache is shared by the whole database, so a result filled under
+// one policy must not be served under another.
+static bool CanFillFromConnection(ClientContext &context) {
+	if (GetSecurityConfig(context).mode != "none") {
+		return false;
+	}
+	return SessionVisibleFromConnection(context);
+}
+
+// Run a call on a separate connection and materialize its result. The call is bound once;
+// the plan that is checked for volatility is the plan that runs.
+static shared_ptr<CachedTableResult> MaterializeTableCall(ClientContext &context, const string &func_name,
+                                                          const vector<Value> &positional,
+                                                          const named_parameter_map_t &named) {
+	Connection connection(DatabaseInstance::GetDatabase(context));
+	auto &fill_context = *connection.context;
+	auto result = make_shared_ptr<CachedTableResult>();
+
+	// Nested apply() calls in the target are checked against the caller's policy
+	GetSecurityConfig(fill_context) = GetSecurityConfig(context);
+
+	connection.BeginTransaction();
+	unique_ptr<LogicalOperator> plan;
+	try {
+		fill_context.RunFunctionInTransaction([&]() {
+			Planner planner(fill_context);
+			planner.CreatePlan(MakeTableFunctionSelect(func_name, positional, named));
+			plan = std::move(planner.plan);
+			result->names = planner.names;
+		});
+	} catch (const Exception &e) {
+		CleanupSecurityConfig(fill_context);
+		throw BinderException("apply_table('%s'): %s", func_name, e.what());
+	}
+
+	// Volatile targets are never cached
+	VolatileExpressionFinder finder;
+	finder.VisitOperator(*plan);
+	if (finder.found) {
+		CleanupSecurityConfig(fill_context);
+		result->is_volatile = true;
+		return result;
+	}
+
+	auto query_result = connection.Query(make_uniq<LogicalPlanStatement>(std::move(plan)));
+	if (query_result->HasError()) {
+		CleanupSecurityConfig(fill_context);
+		throw BinderException("apply_table('%s'): %s", func_name, query_result->GetError());
+	}
+	connection.Commit();
+	CleanupSecurityConfig(fill_context);
+	result->types = query_result->types;
+	result->collection = shared_ptr<ColumnDataCollection>(query_result->TakeCollection().release());
+	result->size = result->collection->SizeInBytes();
+	return result;
+}
+
+// Serve a call from the result cache, filling it on a miss. Returns nullptr for volatile
+// targets and for sessions that bypass the cache, in which case the caller binds the call
+// normally.
+static unique_ptr<TableRef> CachedTableFunctionRef(ClientContext &context, const string &func_name,
+                                                   const vector<Value> &positional,
+                                                   const named_parameter_map_t &named) {
+	if (!CanFillFromConnection(context)) {
+		return nullptr;
+	}
+	auto &cache = GetResultCache(context);
+	auto key = MakeResultCacheKey(context, func_name, positional, named);
+
+	auto result = cache.Lookup(key);
+	if (!result) {
+		result = MaterializeTableCall(context, func_name, positional, named);
+		cache.Insert(key, result);
+	}
+	if (result->is_volatile) {
+		return nullptr;
+	}
+
+	auto pin_id = GetCachePins(context).Pin(std::move(result));
+	vector<unique_ptr<ParsedExpression>> children;
+	children.push_back(make_uniq<ConstantExpression>(Value::UBIGINT(pin_id)));
+	auto table_function = make_uniq<TableFunctionRef>();
+	table_function->function = make_uniq<FunctionExpression>("__func_apply_cache_scan", std::move(children));
+	return std::move(table_function);
+}
+
+// Whether cache := true was given
+static bool GetCacheOption(const named_parameter_map_t &named) {
+	auto it = named.find("cache");
+	if (it == named.end() || it->second.IsNull()) {
+		return false;
+	}
+	return BooleanValue::Get(it->second.DefaultCastAs(LogicalType::BOOLEAN));
+}
+
+//===--------------------------------------------------------------------===//
+// __func_apply_cache_scan(pin UBIGINT) -> TABLE (internal)
+//===--------------------------------------------------------------------===//
+
+struct CacheScanBindData : public TableFunctionData {
+	shared_ptr<CachedTableResult> result;
+};
+
+struct CacheScanGlobalState : public GlobalTableFunctionState {
+	ColumnDataParallelScanState scan_state;
+	idx_t max_threads = 1;
+
+	idx_t MaxThreads() const override {
+		return max_threads;
+	}
+};
+
+struct CacheScanLocalState : public LocalTableFunctionState {
+	ColumnDataLocalScanState scan_state;
+};
+
+static unique_ptr<FunctionData> CacheScanBind(ClientContext &context, TableFunctionBindInput &input,
+                                              vector<LogicalType> &return_types, vector<string> &names) {
+	auto bind_data = make_uniq<CacheScanBindData>();
+	auto pin_id = input.inputs[0].GetValue<uint64_t>();
+	bind_data->result = GetCachePins(context).Get(pin_id);
+	if (!bind_data->result) {
+		throw BinderException("__func_apply_cache_scan is internal to apply_table(..., cache := true)");
+	}
+	return_types = bind_data->result->types;
+	names = bind_data->result->names;
+	return std::move(bind_data);
+}
+
+static unique_ptr<GlobalTableFunctionState> CacheScanInitGlobal(ClientContext &context,
+                                                                TableFunctionInitInput &input) {
+	auto &bind_data = input.bind_data->Cast<CacheScanBindData>();
+	auto result = make_uniq<CacheScanGlobalState>();
+	auto &collection = *bind_data.result->collection;
+	collection.InitializeScan(result->scan_state);
+	result->max_threads = MaxValue<idx_t>(collection.ChunkCount(), 1);
+	return std::move(result);
+}
+
+static unique_ptr<LocalTableFunctionState> CacheScanInitLocal(ExecutionContext &context, TableFunctionInitInput &input,
+                                                              GlobalTableFunctionState *global_state) {
+	return make_uniq<CacheScanLocalState>();
+}
+
+static void CacheScanFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &bind_data = data_p.bind_data->Cast<CacheScanBindData>();
+	auto &gstate = data_p.global_state->Cast<CacheScanGlobalState>();
+	auto &lstate = data_p.local_state->Cast<CacheScanLocalState>();
+	bind_data.result->collection->Scan(gstate.scan_state, lstate.scan_state, output);
+}
+
+// bind_replace for apply_table: replaces the call with a direct call to the target table function
+static unique_ptr<TableRef> ApplyTableBindReplace(ClientContext &context, TableFunctionBindInput &input) {
+	// First argument is the function name
+	if (input.inputs.empty()) {
+		throw BinderException("apply_table requires at least a function name");
+	}
+
+	auto &func_name_val = input.inputs[0];
+	if (func_name_val.IsNull()) {
+		throw BinderException("apply_table: function name cannot be NULL");
+	}
+
+	string func_name = StringValue::Get(func_name_val);
+
+	// Validate function name
+	if (!IsValidIdentifier(func_name)) {
+		throw BinderException("apply_table: invalid function name '%s'", func_name);
+	}
+
+	// Security check - collect args for validation
+	vector<Value> args_for_validation;
+	for (idx_t i = 1; i < input.inputs.size(); i++) {
+		args_for_validation.push_back(input.inputs[i]);
+	}
+
+	// The binder only accepts named parameters registered on apply_table, so none of them are
+	// the target's; those are passed with apply_table_with(kwargs := ...)
+	bool use_cache = GetCacheOption(input.named_parameters);
+
+	// Validate against security policy (will throw if on_block = "error")
 	if (!ValidateFunctionCall(context, func_name, args_for_validation)) {
 		// If we get here, on_block is "null" or "default" - but table functions
 		// can't return those, so we throw a specific error
@@ -930,143 +5072,466 @@ static unique_ptr<TableRef> ApplyTableBindReplace(ClientContext &context, TableF
 	if (!TableFunctionExists(context, func_name)) {
 		// Check if it's a scalar function to give a better error message
 		if (GetCallableFunctionType(context, func_name) != CatalogType::INVALID) {
-			throw BinderException("apply_table: '%s' is a scalar function. Use apply() instead.", func_name);
+			throw BinderException("apply_table: '%s' is a scalar function. Use apply() instead.", func_name);
+		}
+		throw BinderException("apply_table: function '%s' does not exist", func_name);
+	}
+
+	if (use_cache) {
+		auto cached = CachedTableFunctionRef(context, func_name, args_for_validation, {});
+		if (cached) {
+			return cached;
+		}
+	}
+
+	// Replace with func_name(arg1, arg2, ...)
+	return MakeTableFunctionRef(func_name, args_for_validation, {});
+}
+
+//===--------------------------------------------------------------------===//
+// apply_table_with(func VARCHAR, args LIST, kwargs STRUCT) -> TABLE
+//===--------------------------------------------------------------------===//
+
+// bind_replace for apply_table_with: replaces the call with a direct call to the target table function
+static unique_ptr<TableRef> ApplyTableWithBindReplace(ClientContext &context, TableFunctionBindInput &input) {
+	// First argument is the function name
+	if (input.inputs.empty()) {
+		throw BinderException("apply_table_with requires at least a function name");
+	}
+
+	auto &func_name_val = input.inputs[0];
+	if (func_name_val.IsNull()) {
+		throw BinderException("apply_table_with: function name cannot be NULL");
+	}
+
+	string func_name = StringValue::Get(func_name_val);
+
+	// Validate function name
+	if (!IsValidIdentifier(func_name)) {
+		throw BinderException("apply_table_with: invalid function name '%s'", func_name);
+	}
+
+	// Get args from named parameter or second input (needed for security check)
+	Value args_list;
+	Value kwargs_struct;
+
+	// Check named parameters first
+	auto args_it = input.named_parameters.find("args");
+	if (args_it != input.named_parameters.end()) {
+		args_list = args_it->second;
+	} else if (input.inputs.size() > 1) {
+		args_list = input.inputs[1];
+	}
+
+	// Collect args for security validation
+	vector<Value> args_for_validation;
+	if (!args_list.IsNull() && args_list.type().id() == LogicalTypeId::LIST) {
+		auto &list_children = ListValue::GetChildren(args_list);
+		for (auto &child : list_children) {
+			args_for_validation.push_back(child);
+		}
+	}
+
+	// Get kwargs from named parameter or third input
+	auto kwargs_it = input.named_parameters.find("kwargs");
+	if (kwargs_it != input.named_parameters.end()) {
+		kwargs_struct = kwargs_it->second;
+	} else if (input.inputs.size() > 2) {
+		kwargs_struct = input.inputs[2];
+	}
+
+	// Named parameters from the kwargs struct
+	named_parameter_map_t named;
+	if (!kwargs_struct.IsNull() && kwargs_struct.type().id() == LogicalTypeId::STRUCT) {
+		auto &struct_children = StructValue::GetChildren(kwargs_struct);
+		for (idx_t i = 0; i < struct_children.size(); i++) {
+			named[StructType::GetChildName(kwargs_struct.type(), i)] = struct_children[i];
+		}
+	}
+
+	// Validate against security policy (will throw if on_block = "error")
+	if (!ValidateFunctionCall(context, func_name, args_for_validation, named)) {
+		// If we get here, on_block is "null" or "default" - but table functions
+		// can't return those, so we throw a specific error
+		throw BinderException("apply_table_with: function '%s' is blocked by security policy", func_name);
+	}
+
+	// Check if it's a table function
+	if (!TableFunctionExists(context, func_name)) {
+		// Check if it's a scalar function to give a better error message
+		if (GetCallableFunctionType(context, func_name) != CatalogType::INVALID) {
+			throw BinderException("apply_table_with: '%s' is a scalar function. Use apply_with() instead.", func_name);
 		}
-		throw BinderException("apply_table: function '%s' does not exist", func_name);
+		throw BinderException("apply_table_with: function '%s' does not exist", func_name);
 	}
 
-	// Build the SQL query: SELECT * FROM func_name(arg1, arg2, ...)
-	string sql = "SELECT * FROM " + func_name + "(";
-	for (idx_t i = 1; i < input.inputs.size(); i++) {
-		if (i > 1) {
-			sql += ", ";
+	if (GetCacheOption(input.named_parameters)) {
+		auto cached = CachedTableFunctionRef(context, func_name, args_for_validation, named);
+		if (cached) {
+			return cached;
 		}
-		sql += ValueToSQL(input.inputs[i]);
 	}
-	sql += ")";
 
-	// Add named parameters if any
-	if (!input.named_parameters.empty()) {
-		// Named parameters need to be added after regular arguments
-		bool first_named = input.inputs.size() <= 1;
-		for (auto &kv : input.named_parameters) {
-			if (!first_named || input.inputs.size() > 1) {
-				sql = sql.substr(0, sql.length() - 1); // Remove closing paren
-				sql += ", ";
-			} else {
-				sql = sql.substr(0, sql.length() - 1); // Remove closing paren
+	// Replace with func_name(arg1, arg2, ..., kwarg1 := val1, ...)
+	return MakeTableFunctionRef(func_name, args_for_validation, named);
+}
+
+//===--------------------------------------------------------------------===//
+// apply_table_many(func VARCHAR, arg_sets LIST(STRUCT)) -> TABLE
+//===--------------------------------------------------------------------===//
+//
+// Fans one table function out over a list of argument sets:
+//
+//   SELECT * FROM apply_table_many('generate_series', [(1, 3), (10, 12)]);
+//
+// The call is replaced by a single UNION ALL (or UNION ALL BY NAME) node with one
+// branch per argument set. Every branch is an independent pipeline, so the calls run
+// in parallel, and building the node is linear in the number of argument sets.
+//
+// Each argument set is a STRUCT:
+//   - unnamed STRUCT (row(...)): fields are positional arguments
+//   - named STRUCT: 'args' (LIST) holds positional arguments, 'kwargs' (STRUCT) holds
+//     named arguments, and any other field is passed as a named argument
+//
+// Options:
+//   - union_by_name := true  combines branches by column name instead of position
+//   - source_index := true   adds a source_index column with the 1-based position of
+//                            the argument set that produced each row
+
+// Split one argument set STRUCT into positional and named arguments
+static void SplitArgumentSet(const Value &arg_set, vector<Value> &positional, named_parameter_map_t &named) {
+	if (arg_set.IsNull()) {
+		return;
+	}
+	if (arg_set.type().id() != LogicalTypeId::STRUCT) {
+		throw BinderException("apply_table_many: each argument set must be a STRUCT, got %s",
+		                      arg_set.type().ToString());
+	}
+	auto &type = arg_set.type();
+	auto &children = StructValue::GetChildren(arg_set);
+	bool unnamed = StructType::IsUnnamed(type);
+	for (idx_t i = 0; i < children.size(); i++) {
+		if (unnamed) {
+			positional.push_back(children[i]);
+			continue;
+		}
+		auto &name = StructType::GetChildName(type, i);
+		auto lower_name = StringUtil::Lower(name);
+		if (lower_name == "args" && children[i].type().id() == LogicalTypeId::LIST) {
+			if (!children[i].IsNull()) {
+				for (auto &child : ListValue::GetChildren(children[i])) {
+					positional.push_back(child);
+				}
 			}
-			sql += kv.first + " := " + ValueToSQL(kv.second) + ")";
-			first_named = false;
+		} else if (lower_name == "kwargs" && children[i].type().id() == LogicalTypeId::STRUCT) {
+			if (!children[i].IsNull()) {
+				auto &kwargs_type = children[i].type();
+				auto &kwargs = StructValue::GetChildren(children[i]);
+				for (idx_t k = 0; k < kwargs.size(); k++) {
+					named[StructType::GetChildName(kwargs_type, k)] = kwargs[k];
+				}
+			}
+		} else {
+			named[name] = children[i];
 		}
 	}
-
-	// Parse and return as subquery
-	return ParseSubquery(sql, context.GetParserOptions());
 }
 
-//===--------------------------------------------------------------------===//
-// apply_table_with(func VARCHAR, args LIST, kwargs STRUCT) -> TABLE
-//===--------------------------------------------------------------------===//
+// Read an optional BOOLEAN named parameter
+static bool GetBooleanOption(const named_parameter_map_t &named, const string &name) {
+	auto it = named.find(name);
+	if (it == named.end() || it->second.IsNull()) {
+		return false;
+	}
+	return BooleanValue::Get(it->second.DefaultCastAs(LogicalType::BOOLEAN));
+}
 
-// bind_replace for apply_table_with: generates SQL and replaces with subquery
-static unique_ptr<TableRef> ApplyTableWithBindReplace(ClientContext &context, TableFunctionBindInput &input) {
-	// First argument is the function name
-	if (input.inputs.empty()) {
-		throw BinderException("apply_table_with requires at least a function name");
+// bind_replace for apply_table_many: one UNION ALL branch per argument set
+static unique_ptr<TableRef> ApplyTableManyBindReplace(ClientContext &context, TableFunctionBindInput &input) {
+	if (input.inputs.size() != 2) {
+		throw BinderException("apply_table_many requires a function name and a list of argument sets");
 	}
 
 	auto &func_name_val = input.inputs[0];
 	if (func_name_val.IsNull()) {
-		throw BinderException("apply_table_with: function name cannot be NULL");
+		throw BinderException("apply_table_many: function name cannot be NULL");
 	}
 
 	string func_name = StringValue::Get(func_name_val);
 
 	// Validate function name
 	if (!IsValidIdentifier(func_name)) {
-		throw BinderException("apply_table_with: invalid function name '%s'", func_name);
+		throw BinderException("apply_table_many: invalid function name '%s'", func_name);
 	}
 
-	// Get args from named parameter or second input (needed for security check)
-	Value args_list;
-	Value kwargs_struct;
+	// Check if it's a table function
+	if (!TableFunctionExists(context, func_name)) {
+		if (GetCallableFunctionType(context, func_name) != CatalogType::INVALID) {
+			throw BinderException("apply_table_many: '%s' is a scalar function. Use apply() instead.", func_name);
+		}
+		throw BinderException("apply_table_many: function '%s' does not exist", func_name);
+	}
 
-	// Check named parameters first
-	auto args_it = input.named_parameters.find("args");
-	if (args_it != input.named_parameters.end()) {
-		args_list = args_it->second;
-	} else if (input.inputs.size() > 1) {
-		args_list = input.inputs[1];
+	auto &arg_sets = input.inputs[1];
+	if (arg_sets.IsNull() || arg_sets.type().id() != LogicalTypeId::LIST) {
+		throw BinderException("apply_table_many: argument sets must be a LIST of STRUCTs");
+	}
+	auto &sets = ListValue::GetChildren(arg_sets);
+	if (sets.empty()) {
+		throw BinderException("apply_table_many: argument sets cannot be empty");
 	}
 
-	// Collect args for security validation
-	vector<Value> args_for_validation;
-	if (!args_list.IsNull() && args_list.type().id() == LogicalTypeId::LIST) {
-		auto &list_children = ListValue::GetChildren(args_list);
-		for (auto &child : list_children) {
-			args_for_validation.push_back(child);
+	bool union_by_name = GetBooleanOption(input.named_parameters, "union_by_name");
+	bool source_index = GetBooleanOption(input.named_parameters, "source_index");
+
+	auto setop = make_uniq<SetOperationNode>();
+	setop->setop_type = union_by_name ? SetOperationType::UNION_BY_NAME : SetOperationType::UNION;
+	setop->setop_all = true;
+	setop->children.reserve(sets.size());
+
+	for (idx_t i = 0; i < sets.size(); i++) {
+		vector<Value> positional;
+		named_parameter_map_t named;
+		SplitArgumentSet(sets[i], positional, named);
+
+		// Validate against security policy (will throw if on_block = "error")
+		if (!ValidateFunctionCall(context, func_name, positional, named)) {
+			throw BinderException("apply_table_many: function '%s' is blocked by security policy", func_name);
+		}
+
+		auto branch = make_uniq<SelectNode>();
+		if (source_index) {
+			auto index_expr = make_uniq<ConstantExpression>(Value::BIGINT(static_cast<int64_t>(i + 1)));
+			index_expr->alias = "source_index";
+			branch->select_list.push_back(std::move(index_expr));
 		}
+		branch->select_list.push_back(make_uniq<StarExpression>());
+		branch->from_table = MakeTableFunctionRef(func_name, positional, named);
+		setop->children.push_back(std::move(branch));
 	}
 
-	// Validate against security policy (will throw if on_block = "error")
-	if (!ValidateFunctionCall(context, func_name, args_for_validation)) {
-		// If we get here, on_block is "null" or "default" - but table functions
-		// can't return those, so we throw a specific error
-		throw BinderException("apply_table_with: function '%s' is blocked by security policy", func_name);
+	auto statement = make_uniq<SelectStatement>();
+	if (setop->children.size() == 1) {
+		statement->node = std::move(setop->children[0]);
+	} else {
+		statement->node = std::move(setop);
 	}
+	return make_uniq<SubqueryRef>(std::move(statement));
+}
 
-	// Check if it's a table function
-	if (!TableFunctionExists(context, func_name)) {
-		// Check if it's a scalar function to give a better error message
-		if (GetCallableFunctionType(context, func_name) != CatalogType::INVALID) {
-			throw BinderException("apply_table_with: '%s' is a scalar function. Use apply_with() instead.", func_name);
+//===--------------------------------------------------------------------===//
+// apply_table_each(func VARCHAR, ...args ANY, columns := STRUCT) -> TABLE
+//===--------------------------------------------------------------------===//
+//
+// Per-row table function dispatch for lateral joins:
+//
+//   SELECT p.part, t.*
+//   FROM partitions p, apply_table_each(p.reader, p.path, columns := NULL::STRUCT(id BIGINT, v VARCHAR)) t;
+//
+// This is a table in-out function. DuckDB feeds it the evaluated arguments as input
+// columns (one column per argument), and each input row is dispatched as one call to
+// the target table function, whose output chunks are streamed straight through.
+// Input chunks are processed by whichever pipeline thread owns them, so calls run in
+// parallel across input chunks.
+//
+// Because all arguments arrive as input columns (see LATERAL_JOIN_EXPLORATION.md),
+// named parameters are not visible as values at bind time. Two input columns are
+// therefore recognized by name:
+//   - columns: declares the output schema. Only its STRUCT type is used, so pass a
+//              typed value such as NULL::STRUCT(a INTEGER, b VARCHAR).
+//   - kwargs:  a STRUCT whose fields are passed as named parameters to each call.
+// All other input columns are positional arguments.
+//
+// Each call runs on a per-thread Connection, which carries a copy of the caller's security
+// config. Calling back into the caller's own ClientContext while it is executing would
+// deadlock. That connection sees neither TEMP objects nor the uncommitted changes of an
+// explicit transaction, so the bind fails while the caller has either.
+
+struct ApplyTableEachBindData : public TableFunctionData {
+	// Input column holding the function name
+	idx_t func_name_idx = 0;
+	// Input columns passed as positional arguments
+	vector<idx_t> arg_indexes;
+	// Input column holding the kwargs STRUCT (if any)
+	optional_idx kwargs_idx;
+	// Declared output schema
+	vector<LogicalType> return_types;
+	vector<string> names;
+};
+
+struct ApplyTableEachLocalState : public LocalTableFunctionState {
+	// Connection used to run the calls made by this thread
+	unique_ptr<Connection> connection;
+	// Streaming result of the call currently being emitted
+	unique_ptr<QueryResult> result;
+	// Name of the function behind the current result (for error messages)
+	string current_func;
+	// Next input row to dispatch
+	idx_t row_idx = 0;
+
+	~ApplyTableEachLocalState() override {
+		result.reset();
+		if (connection) {
+			CleanupSecurityConfig(*connection->context);
 		}
-		throw BinderException("apply_table_with: function '%s' does not exist", func_name);
 	}
+};
 
-	// Get kwargs from named parameter or third input
-	auto kwargs_it = input.named_parameters.find("kwargs");
-	if (kwargs_it != input.named_parameters.end()) {
-		kwargs_struct = kwargs_it->second;
-	} else if (input.inputs.size() > 2) {
-		kwargs_struct = input.inputs[2];
+static unique_ptr<FunctionData> ApplyTableEachBind(ClientContext &context, TableFunctionBindInput &input,
+                                                   vector<LogicalType> &return_types, vector<string> &names) {
+	auto bind_data = make_uniq<ApplyTableEachBindData>();
+	auto &input_types = input.input_table_types;
+	auto &input_names = input.input_table_names;
+
+	if (input_types.empty()) {
+		throw BinderException("apply_table_each requires at least a function name");
+	}
+	if (input_types[0].id() != LogicalTypeId::VARCHAR) {
+		throw BinderException("apply_table_each: function name must be VARCHAR, got %s", input_types[0].ToString());
+	}
+	if (!SessionVisibleFromConnection(context)) {
+		throw BinderException("apply_table_each: calls run on a separate connection, which cannot see this "
+		                      "connection's TEMP objects or the changes of an open transaction");
+	}
+
+	optional_idx columns_idx;
+	for (idx_t i = 1; i < input_types.size(); i++) {
+		auto name = i < input_names.size() ? StringUtil::Lower(input_names[i]) : string();
+		if (name == "columns" && input_types[i].id() == LogicalTypeId::STRUCT) {
+			columns_idx = i;
+		} else if (name == "kwargs" && input_types[i].id() == LogicalTypeId::STRUCT) {
+			bind_data->kwargs_idx = i;
+		} else {
+			bind_data->arg_indexes.push_back(i);
+		}
 	}
 
-	// Build the SQL query: SELECT * FROM func_name(arg1, arg2, ..., kwarg1 := val1, ...)
-	string sql = "SELECT * FROM " + func_name + "(";
-	bool first = true;
+	if (!columns_idx.IsValid()) {
+		throw BinderException("apply_table_each: the output schema must be declared, e.g. "
+		                      "columns := NULL::STRUCT(a INTEGER, b VARCHAR)");
+	}
 
-	// Add positional args from list
-	if (!args_list.IsNull() && args_list.type().id() == LogicalTypeId::LIST) {
-		auto &list_children = ListValue::GetChildren(args_list);
-		for (auto &child : list_children) {
-			if (!first) {
-				sql += ", ";
-			}
-			sql += ValueToSQL(child);
-			first = false;
+	auto &columns_type = input_types[columns_idx.GetIndex()];
+	for (auto &child : StructType::GetChildTypes(columns_type)) {
+		if (child.first.empty()) {
+			throw BinderException("apply_table_each: declared columns must be named");
 		}
+		names.push_back(child.first);
+		return_types.push_back(child.second);
+	}
+	if (return_types.empty()) {
+		throw BinderException("apply_table_each: declared columns cannot be empty");
 	}
 
-	// Add kwargs from struct
-	if (!kwargs_struct.IsNull() && kwargs_struct.type().id() == LogicalTypeId::STRUCT) {
-		auto &struct_children = StructValue::GetChildren(kwargs_struct);
-		auto &type = kwargs_struct.type();
-		for (idx_t i = 0; i < struct_children.size(); i++) {
-			if (!first) {
-				sql += ", ";
+	bind_data->return_types = return_types;
+	bind_data->names = names;
+	return std::move(bind_data);
+}
+
+static unique_ptr<LocalTableFunctionState> ApplyTableEachInitLocal(ExecutionContext &context,
+                                                                   TableFunctionInitInput &input,
+                                                                   GlobalTableFunctionState *global_state) {
+	auto result = make_uniq<ApplyTableEachLocalState>();
+	result->connection = make_uniq<Connection>(DatabaseInstance::GetDatabase(context.client));
+	// Nested apply() calls in the targets are checked against the caller's policy
+	GetSecurityConfig(*result->connection->context) = GetSecurityConfig(context.client);
+	return std::move(result);
+}
+
+// Start the call for one input row. Returns nullptr if the row produces no output (NULL function name).
+static unique_ptr<QueryResult> StartTableEachCall(ClientContext &context, const ApplyTableEachBindData &bind_data,
+                                                  ApplyTableEachLocalState &state, DataChunk &input, idx_t row) {
+	auto func_name_val = input.data[bind_data.func_name_idx].GetValue(row);
+	if (func_name_val.IsNull()) {
+		return nullptr;
+	}
+	string func_name = StringValue::Get(func_name_val);
+
+	if (!IsValidIdentifier(func_name)) {
+		throw InvalidInputException("apply_table_each: invalid function name '%s'", func_name);
+	}
+
+	vector<Value> positional;
+	for (auto idx : bind_data.arg_indexes) {
+		positional.push_back(input.data[idx].GetValue(row));
+	}
+
+	named_parameter_map_t named;
+	if (bind_data.kwargs_idx.IsValid()) {
+		auto kwargs_struct = input.data[bind_data.kwargs_idx.GetIndex()].GetValue(row);
+		if (!kwargs_struct.IsNull()) {
+			auto &struct_children = StructValue::GetChildren(kwargs_struct);
+			auto &type = kwargs_struct.type();
+			for (idx_t i = 0; i < struct_children.size(); i++) {
+				named[StructType::GetChildName(type, i)] = struct_children[i];
 			}
-			auto &name = StructType::GetChildName(type, i);
-			sql += name + " := " + ValueToSQL(struct_children[i]);
-			first = false;
 		}
 	}
 
-	sql += ")";
+	// Security and existence checks run against the caller's session
+	if (!ValidateFunctionCall(context, func_name, positional, named)) {
+		throw InvalidInputException("apply_table_each: function '%s' is blocked by security policy", func_name);
+	}
+	if (!TableFunctionExists(context, func_name)) {
+		if (GetCallableFunctionType(context, func_name) != CatalogType::INVALID) {
+			throw InvalidInputException("apply_table_each: '%s' is a scalar function. Use apply() instead.", func_name);
+		}
+		throw InvalidInputException("apply_table_each: function '%s' does not exist", func_name);
+	}
+
+	state.current_func = func_name;
+	auto pending = state.connection->PendingQuery(MakeTableFunctionSelect(func_name, positional, named), true);
+	if (pending->HasError()) {
+		throw InvalidInputException("apply_table_each('%s'): %s", func_name, pending->GetError());
+	}
+	auto result = pending->Execute();
+	if (result->HasError()) {
+		throw InvalidInputException("apply_table_each('%s'): %s", func_name, result->GetError());
+	}
+	if (result->ColumnCount() != bind_data.return_types.size()) {
+		throw InvalidInputException("apply_table_each('%s'): function returned %d columns, but %d were declared",
+		                            func_name, result->ColumnCount(), bind_data.return_types.size());
+	}
+	return result;
+}
+
+static OperatorResultType ApplyTableEachFunction(ExecutionContext &context, TableFunctionInput &data_p,
+                                                 DataChunk &input, DataChunk &output) {
+	auto &bind_data = data_p.bind_data->Cast<ApplyTableEachBindData>();
+	auto &state = data_p.local_state->Cast<ApplyTableEachLocalState>();
+
+	while (true) {
+		if (!state.result) {
+			if (state.row_idx >= input.size()) {
+				// All rows of this input chunk have been dispatched
+				state.row_idx = 0;
+				return OperatorResultType::NEED_MORE_INPUT;
+			}
+			state.result = StartTableEachCall(context.client, bind_data, state, input, state.row_idx++);
+			continue;
+		}
+
+		auto chunk = state.result->Fetch();
+		if (!chunk || chunk->size() == 0) {
+			if (state.result->HasError()) {
+				throw InvalidInputException("apply_table_each('%s'): %s", state.current_func,
+				                            state.result->GetError());
+			}
+			state.result.reset();
+			continue;
+		}
 
-	// Parse and return as subquery
-	return ParseSubquery(sql, context.GetParserOptions());
+		// Stream the chunk through, casting to the declared schema where needed
+		for (idx_t col = 0; col < output.ColumnCount(); col++) {
+			if (chunk->data[col].GetType() == output.data[col].GetType()) {
+				output.data[col].Reference(chunk->data[col]);
+			} else {
+				VectorOperations::Cast(context.client, chunk->data[col], output.data[col], chunk->size());
+			}
+		}
+		output.SetCardinality(chunk->size());
+		return OperatorResultType::HAVE_MORE_OUTPUT;
+	}
 }
 
 //===--------------------------------------------------------------------===//
@@ -1274,6 +5739,311 @@ static void GetSecurityConfigScalarFun(DataChunk &args, ExpressionState &state,
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Result Cache Functions
+//===--------------------------------------------------------------------===//
+
+// func_apply_set_cache_limit(limit VARCHAR) -> VARCHAR
+// Sets the memory limit of the apply_table result cache (e.g. '512MB'), evicting as needed
+static void SetCacheLimitScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &context = state.GetContext();
+	auto &limit_vector = args.data[0];
+
+	UnaryExecutor::Execute<string_t, string_t>(limit_vector, result, args.size(), [&](string_t limit_str) {
+		auto limit = DBConfig::ParseMemoryLimit(limit_str.GetString());
+		GetResultCache(context).SetLimit(limit);
+		return StringVector::AddString(result,
+		                               "Result cache limit set to: " + StringUtil::BytesToHumanReadableString(limit));
+	});
+}
+
+// func_apply_clear_cache() -> VARCHAR
+// Drops all cached apply_table results
+static void ClearCacheScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &context = state.GetContext();
+	idx_t count = args.size();
+
+	for (idx_t i = 0; i < count; i++) {
+		GetResultCache(context).Clear();
+		result.SetValue(i, Value("Result cache cleared"));
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Memoization Functions
+//===--------------------------------------------------------------------===//
+
+// func_apply_set_memoize(enabled BOOLEAN [, capacity BIGINT]) -> VARCHAR
+// Turns memoization of dynamic calls on or off for the session; capacity is the number of
+// entries kept per thread and target
+static void SetMemoizeScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &context = state.GetContext();
+	idx_t count = args.size();
+
+	for (idx_t i = 0; i < count; i++) {
+		auto &config = GetMemoConfig(context);
+		auto enabled = args.data[0].GetValue(i);
+		if (enabled.IsNull()) {
+			throw InvalidInputException("func_apply_set_memoize: enabled cannot be NULL");
+		}
+		if (args.ColumnCount() > 1) {
+			auto capacity = args.data[1].GetValue(i);
+			if (capacity.IsNull() || capacity.GetValue<int64_t>() <= 0) {
+				throw InvalidInputException("func_apply_set_memoize: capacity must be a positive number of entries");
+			}
+			config.capacity = NumericCast<idx_t>(capacity.GetValue<int64_t>());
+		}
+		config.enabled = BooleanValue::Get(enabled);
+		result.SetValue(i, Value(config.enabled ? StringUtil::Format("Memoization enabled (%llu entries per target)",
+		                                                             config.capacity)
+		                                        : string("Memoization disabled")));
+	}
+}
+
+// func_apply_memo_stats() -> STRUCT(hits UBIGINT, misses UBIGINT)
+// Memoization hits and misses of the session so far
+static void MemoStatsScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &counters = *GetMemoConfig(state.GetContext()).counters;
+	auto stats = Value::STRUCT({{"hits", Value::UBIGINT(counters.hits)}, {"misses", Value::UBIGINT(counters.misses)}});
+	result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	result.SetValue(0, stats);
+}
+
+//===--------------------------------------------------------------------===//
+// Call Statistics Functions
+//===--------------------------------------------------------------------===//
+
+// func_apply_stats() -> TABLE
+// Call statistics of the session, one row per target function and execution strategy
+struct ApplyStatsGlobalState : public GlobalTableFunctionState {
+	vector<pair<pair<string, string>, ApplyCallStats>> entries;
+	idx_t offset = 0;
+};
+
+static unique_ptr<FunctionData> ApplyStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                                               vector<LogicalType> &return_types, vector<string> &names) {
+	names = {"function",     "kind",         "strategy",  "calls",       "rows",        "fallback_rows",
+	         "bind_time_ns", "exec_time_ns", "memo_hits", "memo_misses", "blocked_rows"};
+	return_types = {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR};
+	return_types.resize(names.size(), LogicalType::UBIGINT);
+	return make_uniq<TableFunctionData>();
+}
+
+static unique_ptr<GlobalTableFunctionState> ApplyStatsInitGlobal(ClientContext &context,
+                                                                 TableFunctionInitInput &input) {
+	auto result = make_uniq<ApplyStatsGlobalState>();
+	auto stats = GetSessionStats(context).Get();
+	result->entries.assign(stats.begin(), stats.end());
+	return std::move(result);
+}
+
+static void ApplyStatsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &gstate = data_p.global_state->Cast<ApplyStatsGlobalState>();
+	idx_t count = 0;
+	while (gstate.offset < gstate.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = gstate.entries[gstate.offset++];
+		auto &stats = entry.second;
+		output.SetValue(0, count, Value(entry.first.first));
+		output.SetValue(1, count, Value(stats.kind));
+		output.SetValue(2, count, Value(entry.first.second));
+		output.SetValue(3, count, Value::UBIGINT(stats.calls));
+		output.SetValue(4, count, Value::UBIGINT(stats.rows));
+		output.SetValue(5, count, Value::UBIGINT(stats.fallback_rows));
+		output.SetValue(6, count, Value::UBIGINT(stats.bind_ns));
+		output.SetValue(7, count, Value::UBIGINT(stats.exec_ns));
+		output.SetValue(8, count, Value::UBIGINT(stats.memo_hits));
+		output.SetValue(9, count, Value::UBIGINT(stats.memo_misses));
+		output.SetValue(10, count, Value::UBIGINT(stats.blocked_rows));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+// func_apply_reset_stats() -> VARCHAR
+// Clears the session's call statistics and memoization counters
+static void ResetStatsScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &context = state.GetContext();
+	idx_t count = args.size();
+
+	for (idx_t i = 0; i < count; i++) {
+		GetSessionStats(context).Reset();
+		auto &counters = *GetMemoConfig(context).counters;
+		counters.hits = 0;
+		counters.misses = 0;
+		result.SetValue(i, Value("Statistics reset"));
+	}
+}
+
+// func_apply_explain(query VARCHAR) -> TABLE
+// How each apply expression of a query is dispatched, one row per target. The query is
+// planned and optimized, but not run, on a separate connection, so that the caller's own
+// ClientContext is not re-entered while it is executing. Strategies are those of
+// func_apply_stats(); expressions that were folded into constants are not listed.
+//
+// The separate connection gets the caller's func_apply security settings, so calls are
+// checked (and folded or not) as they would be for the caller. It does not see the caller's
+// TEMP objects, the uncommitted changes of its open transaction, or its SET options.
+struct ApplyExplainBindData : public TableFunctionData {
+	vector<vector<Value>> rows;
+};
+
+struct ApplyExplainGlobalState : public GlobalTableFunctionState {
+	idx_t offset = 0;
+};
+
+// Collects the apply expressions of a plan with the operator they appear in
+class ApplyExpressionFinder : public LogicalOperatorVisitor {
+public:
+	explicit ApplyExpressionFinder(ClientContext &context_p) : context(context_p) {
+	}
+
+	vector<vector<Value>> rows;
+
+	void VisitOperator(LogicalOperator &op) override {
+		VisitOperatorChildren(op);
+		current = &op;
+		VisitOperatorExpressions(op);
+	}
+
+	void VisitExpression(unique_ptr<Expression> *expression) override {
+		auto &expr = **expression;
+		if (expr.GetExpressionClass() == ExpressionClass::BOUND_FUNCTION) {
+			auto &func_expr = expr.Cast<BoundFunctionExpression>();
+			if (func_expr.function.init_local_state == ApplyInitLocalState) {
+				AddExpression(func_expr);
+			}
+		}
+		VisitExpressionChildren(expr);
+	}
+
+private:
+	ClientContext &context;
+	optional_ptr<LogicalOperator> current;
+
+	void AddExpression(const BoundFunctionExpression &expr) {
+		auto &function = expr.function;
+		auto &bind_info = expr.bind_info;
+		auto &name = function.name;
+		// Only these narrow down the failing rows of a group instead of failing the query
+		bool row_fallback = name == "try_apply" || name == "try_apply_with" || name == "apply_result";
+		auto constant_strategy = expr.children[0]->IsFoldable() ? "constant" : "grouped";
+
+		if (function.bind == BindApplyChain) {
+			auto &chain = bind_info->Cast<ApplyChainBindData>().chain;
+			if (chain) {
+				AddRow(expr, Value(StringUtil::Lower(StringUtil::Join(chain->names, " > "))), "chain", "prebound",
+				       row_fallback);
+			} else {
+				AddRow(expr, Value(), "chain", "grouped", row_fallback);
+			}
+			return;
+		}
+		if (function.bind == BindApplyExpr) {
+			auto &constant_expr = bind_info->Cast<ApplyExprBindData>().expr;
+			if (constant_expr) {
+				AddRow(expr, Value(constant_expr->text), "expression", "prebound", row_fallback);
+			} else {
+				AddRow(expr, Value(), "expression", "grouped", row_fallback);
+			}
+			return;
+		}
+		if (function.bind == BindApplyEach || function.bind == BindApplyMany) {
+			for (auto &func_name : bind_info->Cast<ApplyFanOutBindData>().func_names) {
+				AddTargetRow(expr, func_name, "constant", row_fallback);
+			}
+			return;
+		}
+		if (bind_info && (function.bind == BindApply || function.bind == BindApplyResult ||
+		                  function.bind == BindApplyDispatcher)) {
+			for (auto &func_name : bind_info->Cast<ApplyBindData>().candidates->names) {
+				AddTargetRow(expr, func_name, "prebound", row_fallback);
+			}
+			return;
+		}
+		if (function.bind == BindApplyWith && bind_info) {
+			auto &partial = bind_info->Cast<ApplyWithBindData>().partial;
+			if (partial) {
+				AddTargetRow(expr, partial->func_name, "constant", row_fallback);
+				return;
+			}
+		}
+		if (expr.children[0]->IsFoldable()) {
+			auto func_name = ExpressionExecutor::EvaluateScalar(context, *expr.children[0]);
+			if (!func_name.IsNull() && func_name.type().id() == LogicalTypeId::VARCHAR) {
+				AddTargetRow(expr, StringValue::Get(func_name), constant_strategy, row_fallback);
+				return;
+			}
+		}
+		AddRow(expr, Value(), Value(), constant_strategy, row_fallback);
+	}
+
+	void AddTargetRow(const BoundFunctionExpression &expr, const string &func_name, const string &strategy,
+	                  bool row_fallback) {
+		auto func_type = GetCallableFunctionType(context, func_name);
+		Value kind;
+		if (func_type == CatalogType::MACRO_ENTRY) {
+			kind = Value("macro");
+		} else if (func_type == CatalogType::SCALAR_FUNCTION_ENTRY) {
+			kind = Value("function");
+		}
+		AddRow(expr, Value(StringUtil::Lower(func_name)), std::move(kind), strategy, row_fallback);
+	}
+
+	void AddRow(const BoundFunctionExpression &expr, Value target, Value kind, const string &strategy,
+	            bool row_fallback) {
+		rows.push_back({Value(current ? current->GetName() : string()), Value(expr.function.name), std::move(target),
+		                std::move(kind), Value(strategy), Value::BOOLEAN(row_fallback), Value(expr.ToString())});
+	}
+};
+
+static unique_ptr<FunctionData> ApplyExplainBind(ClientContext &context, TableFunctionBindInput &input,
+                                                 vector<LogicalType> &return_types, vector<string> &names) {
+	if (input.inputs[0].IsNull()) {
+		throw BinderException("func_apply_explain: query must not be NULL");
+	}
+	auto query = StringValue::Get(input.inputs[0]);
+
+	Connection connection(DatabaseInstance::GetDatabase(context));
+	auto &planning_context = *connection.context;
+	GetSecurityConfig(planning_context) = GetSecurityConfig(context);
+	unique_ptr<LogicalOperator> plan;
+	try {
+		plan = planning_context.ExtractPlan(query);
+	} catch (const Exception &e) {
+		CleanupSecurityConfig(planning_context);
+		throw BinderException("func_apply_explain: %s", e.what());
+	}
+	CleanupSecurityConfig(planning_context);
+	ApplyExpressionFinder finder(context);
+	finder.VisitOperator(*plan);
+
+	auto result = make_uniq<ApplyExplainBindData>();
+	result->rows = std::move(finder.rows);
+	names = {"operator", "function", "target", "kind", "strategy", "row_fallback", "expression"};
+	return_types = {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR,
+	                LogicalType::VARCHAR, LogicalType::BOOLEAN, LogicalType::VARCHAR};
+	return std::move(result);
+}
+
+static unique_ptr<GlobalTableFunctionState> ApplyExplainInitGlobal(ClientContext &context,
+                                                                   TableFunctionInitInput &input) {
+	return make_uniq<ApplyExplainGlobalState>();
+}
+
+static void ApplyExplainFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &bind_data = data_p.bind_data->Cast<ApplyExplainBindData>();
+	auto &gstate = data_p.global_state->Cast<ApplyExplainGlobalState>();
+	idx_t count = 0;
+	while (gstate.offset < bind_data.rows.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &row = bind_data.rows[gstate.offset++];
+		for (idx_t col = 0; col < row.size(); col++) {
+			output.SetValue(col, count, row[col]);
+		}
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
 static void LoadInternal(ExtensionLoader &loader) {
 	// Register function_exists
 	auto function_exists_func =
@@ -1284,33 +6054,231 @@ static void LoadInternal(ExtensionLoader &loader) {
 	auto apply_func = ScalarFunction("apply", {LogicalType::VARCHAR}, LogicalType::ANY, ApplyScalarFun, BindApply);
 	apply_func.varargs = LogicalType::ANY;
 	apply_func.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	apply_func.init_local_state = ApplyInitLocalState;
 	loader.RegisterFunction(apply_func);
 
+	// Register try_apply (NULL for rows that fail) and apply_result (value and error message)
+	auto try_apply_func =
+	    ScalarFunction("try_apply", {LogicalType::VARCHAR}, LogicalType::ANY, TryApplyScalarFun, BindApply);
+	try_apply_func.varargs = LogicalType::ANY;
+	try_apply_func.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	try_apply_func.init_local_state = ApplyInitLocalState;
+	loader.RegisterFunction(try_apply_func);
+
+	auto apply_result_func =
+	    ScalarFunction("apply_result", {LogicalType::VARCHAR}, LogicalType::ANY, ApplyResultScalarFun, BindApplyResult);
+	apply_result_func.varargs = LogicalType::ANY;
+	apply_result_func.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	apply_result_func.init_local_state = ApplyInitLocalState;
+	loader.RegisterFunction(apply_result_func);
+
 	// Register apply_with (structured with named params support)
 	// Uses varargs to support: apply_with(func, args) or apply_with(func, args, kwargs)
 	// or named: apply_with(func, args := [...], kwargs := {...})
+	// func is ANY so that it can also be a partial() descriptor; other types are cast to VARCHAR
 	auto apply_with_func =
-	    ScalarFunction("apply_with", {LogicalType::VARCHAR}, LogicalType::ANY, ApplyWithScalarFun, BindApplyWith);
+	    ScalarFunction("apply_with", {LogicalType::ANY}, LogicalType::ANY, ApplyWithScalarFun, BindApplyWith);
 	apply_with_func.varargs = LogicalType::ANY;
 	apply_with_func.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	apply_with_func.init_local_state = ApplyInitLocalState;
 	loader.RegisterFunction(apply_with_func);
 
+	// Register try_apply_with (NULL for rows that fail)
+	auto try_apply_with_func = ScalarFunction("try_apply_with", {LogicalType::ANY}, LogicalType::ANY,
+	                                          TryApplyWithScalarFun, BindApplyWith);
+	try_apply_with_func.varargs = LogicalType::ANY;
+	try_apply_with_func.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	try_apply_with_func.init_local_state = ApplyInitLocalState;
+	loader.RegisterFunction(try_apply_with_func);
+
+	// Register partial (function descriptors for apply_with)
+	auto partial_func =
+	    ScalarFunction("partial", {LogicalType::VARCHAR}, LogicalType::ANY, PartialScalarFun, BindPartial);
+	partial_func.varargs = LogicalType::ANY;
+	partial_func.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	loader.RegisterFunction(partial_func);
+
+	// Register apply_chain (a pipeline of functions fused into one expression)
+	auto apply_chain_func = ScalarFunction("apply_chain", {LogicalType::LIST(LogicalType::VARCHAR)}, LogicalType::ANY,
+	                                       ApplyChainScalarFun, BindApplyChain);
+	apply_chain_func.varargs = LogicalType::ANY;
+	apply_chain_func.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	apply_chain_func.init_local_state = ApplyInitLocalState;
+	loader.RegisterFunction(apply_chain_func);
+
+	// Register apply_expr (expressions given as text, with $n placeholders)
+	auto apply_expr_func =
+	    ScalarFunction("apply_expr", {LogicalType::VARCHAR}, LogicalType::ANY, ApplyExprScalarFun, BindApplyExpr);
+	apply_expr_func.varargs = LogicalType::ANY;
+	apply_expr_func.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	apply_expr_func.init_local_state = ApplyInitLocalState;
+	loader.RegisterFunction(apply_expr_func);
+
+	// Register apply_map and apply_filter (a function over list elements)
+	auto apply_map_func = ScalarFunction("apply_map", {LogicalType::VARCHAR, LogicalType::ANY}, LogicalType::ANY,
+	                                     ApplyMapScalarFun, BindApplyList);
+	apply_map_func.varargs = LogicalType::ANY;
+	apply_map_func.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	apply_map_func.init_local_state = ApplyInitLocalState;
+	loader.RegisterFunction(apply_map_func);
+
+	auto apply_filter_func = ScalarFunction("apply_filter", {LogicalType::VARCHAR, LogicalType::ANY}, LogicalType::ANY,
+	                                        ApplyFilterScalarFun, BindApplyList);
+	apply_filter_func.varargs = LogicalType::ANY;
+	apply_filter_func.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	apply_filter_func.init_local_state = ApplyInitLocalState;
+	loader.RegisterFunction(apply_filter_func);
+
+	// Register apply_reduce (a left fold over list elements)
+	auto apply_reduce_func = ScalarFunction("apply_reduce", {LogicalType::VARCHAR, LogicalType::ANY}, LogicalType::ANY,
+	                                        ApplyReduceScalarFun, BindApplyReduce);
+	apply_reduce_func.varargs = LogicalType::ANY;
+	apply_reduce_func.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	apply_reduce_func.init_local_state = ApplyInitLocalState;
+	loader.RegisterFunction(apply_reduce_func);
+
+	// Register apply_each and apply_many (fan-out calls returning a STRUCT)
+	auto apply_each_func = ScalarFunction("apply_each", {LogicalType::VARCHAR}, LogicalType::ANY, ApplyEachScalarFun,
+	                                      BindApplyEach);
+	apply_each_func.varargs = LogicalType::ANY;
+	apply_each_func.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	apply_each_func.init_local_state = ApplyInitLocalState;
+	loader.RegisterFunction(apply_each_func);
+
+	auto apply_many_func = ScalarFunction("apply_many", {LogicalType::LIST(LogicalType::VARCHAR)}, LogicalType::ANY,
+	                                      ApplyManyScalarFun, BindApplyMany);
+	apply_many_func.varargs = LogicalType::ANY;
+	apply_many_func.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	apply_many_func.init_local_state = ApplyInitLocalState;
+	loader.RegisterFunction(apply_many_func);
+
+	// Register apply_fields (a function over the fields of a STRUCT or the values of a MAP)
+	auto apply_fields_func = ScalarFunction("apply_fields", {LogicalType::VARCHAR, LogicalType::ANY}, LogicalType::ANY,
+	                                        ApplyFieldsScalarFun, BindApplyFields);
+	apply_fields_func.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	apply_fields_func.init_local_state = ApplyInitLocalState;
+	loader.RegisterFunction(apply_fields_func);
+
+	// func_apply_create_dispatcher(name VARCHAR, candidates VARCHAR[] [, on_unknown VARCHAR]) -> VARCHAR
+	// Volatile, like func_apply_drop_dispatcher: both modify the catalog and must never be folded
+	ScalarFunctionSet create_dispatcher_set("func_apply_create_dispatcher");
+	ScalarFunction create_dispatcher({LogicalType::VARCHAR, LogicalType::LIST(LogicalType::VARCHAR)},
+	                                 LogicalType::VARCHAR, CreateDispatcherScalarFun);
+	create_dispatcher.stability = FunctionStability::VOLATILE;
+	create_dispatcher_set.AddFunction(create_dispatcher);
+	create_dispatcher.arguments.push_back(LogicalType::VARCHAR);
+	create_dispatcher_set.AddFunction(create_dispatcher);
+	loader.RegisterFunction(create_dispatcher_set);
+
+	// func_apply_drop_dispatcher(name VARCHAR) -> VARCHAR
+	ScalarFunction drop_dispatcher("func_apply_drop_dispatcher", {LogicalType::VARCHAR}, LogicalType::VARCHAR,
+	                               DropDispatcherScalarFun);
+	drop_dispatcher.stability = FunctionStability::VOLATILE;
+	loader.RegisterFunction(drop_dispatcher);
+
+	// Register apply_agg (aggregate, variadic)
+	// The bind callback replaces it with the target aggregate function
+	AggregateFunction apply_agg_func("apply_agg", {LogicalType::VARCHAR}, LogicalType::ANY, nullptr, nullptr, nullptr,
+	                                 nullptr, nullptr, FunctionNullHandling::DEFAULT_NULL_HANDLING, nullptr,
+	                                 BindApplyAgg);
+	apply_agg_func.varargs = LogicalType::ANY;
+	loader.RegisterFunction(apply_agg_func);
+
+	// Register apply_window (aggregate placeholder, used with OVER)
+	// Window aggregates bind like apply_agg; ranking and navigation functions are rewritten
+	// into native window expressions by the optimizer extension
+	AggregateFunction apply_window_func("apply_window", {LogicalType::VARCHAR}, LogicalType::ANY, nullptr, nullptr,
+	                                    nullptr, nullptr, nullptr, FunctionNullHandling::DEFAULT_NULL_HANDLING,
+	                                    nullptr, BindApplyWindow);
+	apply_window_func.varargs = LogicalType::ANY;
+	loader.RegisterFunction(apply_window_func);
+
+	OptimizerExtension apply_window_optimizer;
+	apply_window_optimizer.optimize_function = ApplyWindowOptimize;
+	DBConfig::GetConfig(loader.GetDatabaseInstance()).optimizer_extensions.push_back(apply_window_optimizer);
+
 	// Register apply_table (table function with variadic args)
-	// Uses bind_replace to generate SQL dynamically
+	// Uses bind_replace to substitute a direct call to the target table function
 	TableFunction apply_table_func("apply_table", {LogicalType::VARCHAR}, nullptr, nullptr);
 	apply_table_func.varargs = LogicalType::ANY;
+	apply_table_func.named_parameters["cache"] = LogicalType::BOOLEAN;
 	apply_table_func.bind_replace = ApplyTableBindReplace;
 	loader.RegisterFunction(apply_table_func);
 
 	// Register apply_table_with (structured table function with args list and kwargs struct)
-	// Uses bind_replace to generate SQL dynamically
+	// Uses bind_replace to substitute a direct call to the target table function
 	TableFunction apply_table_with_func("apply_table_with", {LogicalType::VARCHAR}, nullptr, nullptr);
 	apply_table_with_func.varargs = LogicalType::ANY;
 	apply_table_with_func.named_parameters["args"] = LogicalType::ANY;
 	apply_table_with_func.named_parameters["kwargs"] = LogicalType::ANY;
+	apply_table_with_func.named_parameters["cache"] = LogicalType::BOOLEAN;
 	apply_table_with_func.bind_replace = ApplyTableWithBindReplace;
 	loader.RegisterFunction(apply_table_with_func);
 
+	// Register apply_table_many (one table function over a list of argument sets)
+	// Uses bind_replace to substitute a UNION ALL with one branch per argument set
+	TableFunction apply_table_many_func("apply_table_many", {LogicalType::VARCHAR, LogicalType::ANY}, nullptr,
+	                                    nullptr);
+	apply_table_many_func.named_parameters["union_by_name"] = LogicalType::BOOLEAN;
+	apply_table_many_func.named_parameters["source_index"] = LogicalType::BOOLEAN;
+	apply_table_many_func.bind_replace = ApplyTableManyBindReplace;
+	loader.RegisterFunction(apply_table_many_func);
+
+	// Register apply_table_each (in-out table function for lateral per-row calls)
+	// All arguments arrive as input columns; see ApplyTableEachBind
+	TableFunction apply_table_each_func("apply_table_each", {LogicalTypeId::TABLE}, nullptr, ApplyTableEachBind,
+	                                    nullptr, ApplyTableEachInitLocal);
+	apply_table_each_func.in_out_function = ApplyTableEachFunction;
+	loader.RegisterFunction(apply_table_each_func);
+
+	// Register __func_apply_cache_scan (internal: scans a result handed over by cache := true)
+	TableFunction cache_scan_func("__func_apply_cache_scan", {LogicalType::UBIGINT}, CacheScanFunction,
+	                              CacheScanBind, CacheScanInitGlobal, CacheScanInitLocal);
+	loader.RegisterFunction(cache_scan_func);
+
+	// func_apply_set_cache_limit(limit VARCHAR) -> VARCHAR
+	auto set_cache_limit_func = ScalarFunction("func_apply_set_cache_limit", {LogicalType::VARCHAR},
+	                                           LogicalType::VARCHAR, SetCacheLimitScalarFun);
+	loader.RegisterFunction(set_cache_limit_func);
+
+	// func_apply_clear_cache() -> VARCHAR
+	auto clear_cache_func = ScalarFunction("func_apply_clear_cache", {}, LogicalType::VARCHAR, ClearCacheScalarFun);
+	loader.RegisterFunction(clear_cache_func);
+
+	//===--------------------------------------------------------------------===//
+	// Memoization Functions
+	//===--------------------------------------------------------------------===//
+
+	// func_apply_set_memoize(enabled BOOLEAN [, capacity BIGINT]) -> VARCHAR
+	ScalarFunctionSet set_memoize_set("func_apply_set_memoize");
+	set_memoize_set.AddFunction(ScalarFunction({LogicalType::BOOLEAN}, LogicalType::VARCHAR, SetMemoizeScalarFun));
+	set_memoize_set.AddFunction(
+	    ScalarFunction({LogicalType::BOOLEAN, LogicalType::BIGINT}, LogicalType::VARCHAR, SetMemoizeScalarFun));
+	loader.RegisterFunction(set_memoize_set);
+
+	// func_apply_memo_stats() -> STRUCT(hits UBIGINT, misses UBIGINT)
+	auto memo_stats_func = ScalarFunction(
+	    "func_apply_memo_stats", {},
+	    LogicalType::STRUCT({{"hits", LogicalType::UBIGINT}, {"misses", LogicalType::UBIGINT}}), MemoStatsScalarFun);
+	loader.RegisterFunction(memo_stats_func);
+
+	//===--------------------------------------------------------------------===//
+	// Call Statistics Functions
+	//===--------------------------------------------------------------------===//
+
+	// func_apply_stats() -> TABLE
+	TableFunction stats_func("func_apply_stats", {}, ApplyStatsFunction, ApplyStatsBind, ApplyStatsInitGlobal);
+	loader.RegisterFunction(stats_func);
+
+	// func_apply_reset_stats() -> VARCHAR
+	auto reset_stats_func = ScalarFunction("func_apply_reset_stats", {}, LogicalType::VARCHAR, ResetStatsScalarFun);
+	loader.RegisterFunction(reset_stats_func);
+
+	// func_apply_explain(query VARCHAR) -> TABLE
+	TableFunction explain_func("func_apply_explain", {LogicalType::VARCHAR}, ApplyExplainFunction, ApplyExplainBind,
+	                           ApplyExplainInitGlobal);
+	loader.RegisterFunction(explain_func);
+
 	//===--------------------------------------------------------------------===//
 	// Security Configuration Functions
 	//===--------------------------------------------------------------------===//